@@ -0,0 +1,33 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include "mainExtension.hpp"
+
+int main(int argc, char *argv[])
+{
+  using namespace anikanov;
+
+  if (argc > 2) {
+    printUsingError(std::cerr);
+    return 1;
+  }
+
+  size_t size = 20000;
+  if (argc == 2) {
+    try {
+      size = std::stoul(argv[1]);
+    } catch (const std::logic_error &) {
+      printInvalidCount(std::cerr);
+      return 1;
+    }
+  }
+
+  if (size < 1) {
+    printInvalidCount(std::cerr);
+    return 1;
+  }
+
+  runBenchmarks(size, std::cout);
+  return 0;
+}
@@ -0,0 +1,99 @@
+#include "mainExtension.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <string>
+
+void anikanov::fillList(benchList &list, size_t size)
+{
+  list.clear();
+  for (size_t i = 0; i < size; ++i) {
+    list.push_back(static_cast< int >(i * 7919 % size));
+  }
+}
+
+double anikanov::measure(const benchCase &run, size_t size, unsigned long long &checksum)
+{
+  using clock_t = std::chrono::steady_clock;
+  using milliseconds_t = std::chrono::duration< double, std::milli >;
+
+  benchList list;
+  fillList(list, size);
+  clock_t::time_point start = clock_t::now();
+  checksum += run(list);
+  milliseconds_t time = clock_t::now() - start;
+  return time.count();
+}
+
+void anikanov::runBenchmarks(size_t size, std::ostream &os)
+{
+  std::pair< std::string, benchCase > cases[] = {
+    {"indexed loop forward", [size](benchList &list) {
+      unsigned long long sum = 0;
+      for (size_t i = 0; i < size; ++i) {
+        sum += list[i];
+      }
+      return sum;
+    }},
+    {"indexed loop backward", [size](benchList &list) {
+      unsigned long long sum = 0;
+      for (size_t i = size; i > 0; --i) {
+        sum += list[i - 1];
+      }
+      return sum;
+    }},
+    {"last element by index", [size](benchList &list) {
+      unsigned long long sum = 0;
+      for (size_t i = 0; i < size; ++i) {
+        sum += list[list.size() - 1];
+      }
+      return sum;
+    }},
+    {"pop back", [](benchList &list) {
+      unsigned long long count = 0;
+      while (!list.empty()) {
+        list.pop();
+        ++count;
+      }
+      return count;
+    }},
+    {"reverse", [](benchList &list) {
+      list.reverse();
+      return static_cast< unsigned long long >(*list.begin());
+    }},
+    {"splice whole list", [size](benchList &list) {
+      benchList other;
+      fillList(other, size);
+      list.splice(list.end(), other, other.begin(), other.end());
+      return static_cast< unsigned long long >(list.size());
+    }},
+    {"remove_if (odd)", [](benchList &list) {
+      list.remove_if([](int value) {
+        return value % 2 != 0;
+      });
+      return static_cast< unsigned long long >(list.size());
+    }},
+    {"copy", [](benchList &list) {
+      benchList copied = list.copy();
+      return static_cast< unsigned long long >(copied.size());
+    }}
+  };
+
+  unsigned long long checksum = 0;
+  os << std::fixed << std::setprecision(3);
+  for (auto &benchmark: cases) {
+    double time = measure(benchmark.second, size, checksum);
+    os << std::left << std::setw(24) << benchmark.first << time << " ms\n";
+  }
+  os << "checksum " << checksum << "\n";
+}
+
+void anikanov::printUsingError(std::ostream &os)
+{
+  os << "Usage: lab [count]\n";
+}
+
+void anikanov::printInvalidCount(std::ostream &os)
+{
+  os << "Invalid count\n";
+}
@@ -0,0 +1,19 @@
+#ifndef MAINEXTENSION_HPP
+#define MAINEXTENSION_HPP
+
+#include <iostream>
+#include <functional>
+#include <list.hpp>
+
+namespace anikanov {
+  using benchList = List< int >;
+  using benchCase = std::function< unsigned long long(benchList &) >;
+
+  void fillList(benchList &list, size_t size);
+  double measure(const benchCase &run, size_t size, unsigned long long &checksum);
+  void runBenchmarks(size_t size, std::ostream &os);
+  void printUsingError(std::ostream &os);
+  void printInvalidCount(std::ostream &os);
+}
+
+#endif
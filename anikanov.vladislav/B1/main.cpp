@@ -0,0 +1,74 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../S1/mainExtensions.hpp"
+
+namespace {
+  using benchClock = std::chrono::steady_clock;
+
+  double toMilliseconds(benchClock::duration duration)
+  {
+    return std::chrono::duration< double, std::milli >(duration).count();
+  }
+
+  std::string generateInput(size_t sequences, size_t length)
+  {
+    std::ostringstream out;
+    for (size_t i = 0; i < sequences; ++i) {
+      out << "seq" << i;
+      for (size_t j = 0; j < length; ++j) {
+        out << " " << (i * 31 + j * 17) % 1000;
+      }
+      out << "\n";
+    }
+    return out.str();
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  using namespace anikanov;
+
+  if (argc > 3) {
+    std::cerr << "Usage: lab [sequences] [length]\n";
+    return 1;
+  }
+
+  size_t sequences = 10000;
+  size_t length = 10000;
+  try {
+    if (argc > 1) {
+      sequences = std::stoul(argv[1]);
+    }
+    if (argc > 2) {
+      length = std::stoul(argv[2]);
+    }
+  } catch (const std::logic_error &) {
+    std::cerr << "Invalid size\n";
+    return 1;
+  }
+
+  auto start = benchClock::now();
+  std::istringstream input(generateInput(sequences, length));
+  auto parseStart = benchClock::now();
+  std::unique_ptr< mainList > lists(new mainList);
+  inputList(lists, input);
+  auto countStart = benchClock::now();
+  std::ostream nowhere(nullptr);
+  getSums response = countList(lists, nowhere);
+  auto printStart = benchClock::now();
+  printList(response.first, nowhere);
+  auto finish = benchClock::now();
+
+  std::cout << sequences << " sequences of " << length << " numbers\n";
+  std::cout << "generate  " << toMilliseconds(parseStart - start) << " ms\n";
+  std::cout << "parse     " << toMilliseconds(countStart - parseStart) << " ms\n";
+  std::cout << "transpose " << toMilliseconds(printStart - countStart) << " ms\n";
+  std::cout << "sums      " << toMilliseconds(finish - printStart) << " ms, " << response.first.size() << " columns";
+  std::cout << (response.second ? ", overflow" : "") << "\n";
+  return 0;
+}
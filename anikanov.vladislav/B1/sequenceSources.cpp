@@ -0,0 +1,3 @@
+// The Makefile links only the lab's own directory and common,
+// so the S1 sequence processing is compiled into the benchmark from here.
+#include "../S1/mainExtensions.cpp"
@@ -43,7 +43,7 @@ void anikanov::GraphMenuScene::update()
       int a = 0;
       int b = 0;
       int c = 0;
-      if (!(*in >> a >> b >> c)) {
+      if (!(*in >> a >> b >> c) || a < 0 || b < 0) {
         *out << "Invalid input.\n";
         *out << "correct: 1 2 10\n";
         in->clear();
@@ -97,7 +97,7 @@ void anikanov::GraphMenuScene::onClose()
 {
   auto manager = this->manager.lock();
   if (!manager->isRunning()) {
-    auto answer = runKruskalMST(edges, edges.size());
+    auto answer = runKruskalMST(edges);
 
     int sum = std::accumulate(answer.begin(), answer.end(), 0, [](int sum, List< int > &edge) {
       return sum + edge[2];
@@ -0,0 +1,166 @@
+#include "kruskal.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace {
+  uint32_t toKey(int value)
+  {
+    return static_cast< uint32_t >(value) ^ 0x80000000u;
+  }
+
+  std::vector< uint32_t > radixOrder(const std::vector< uint32_t > &keys)
+  {
+    const size_t n = keys.size();
+    std::vector< uint32_t > order(n);
+    std::iota(order.begin(), order.end(), 0);
+    if (n < 2) {
+      return order;
+    }
+    std::vector< uint32_t > buffer(n);
+    for (unsigned shift = 0; shift < 32; shift += 16) {
+      std::vector< size_t > counts(0x10001, 0);
+      for (size_t i = 0; i < n; ++i) {
+        counts[((keys[order[i]] >> shift) & 0xFFFF) + 1]++;
+      }
+      if (counts[((keys[0] >> shift) & 0xFFFF) + 1] == n) {
+        continue;
+      }
+      std::partial_sum(counts.begin(), counts.end(), counts.begin());
+      for (size_t i = 0; i < n; ++i) {
+        buffer[counts[(keys[order[i]] >> shift) & 0xFFFF]++] = order[i];
+      }
+      order.swap(buffer);
+    }
+    return order;
+  }
+}
+
+size_t anikanov::EdgeList::size() const
+{
+  return weight.size();
+}
+
+void anikanov::EdgeList::reserve(size_t count)
+{
+  from.reserve(count);
+  to.reserve(count);
+  weight.reserve(count);
+}
+
+void anikanov::EdgeList::push_back(int a, int b, int w)
+{
+  from.push_back(a);
+  to.push_back(b);
+  weight.push_back(w);
+}
+
+void anikanov::EdgeList::clear()
+{
+  from.clear();
+  to.clear();
+  weight.clear();
+}
+
+anikanov::DisjointSets::DisjointSets(size_t count):
+  parent(count),
+  rank(count, 0)
+{
+  std::iota(parent.begin(), parent.end(), 0);
+}
+
+int anikanov::DisjointSets::find(int i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+bool anikanov::DisjointSets::merge(int x, int y)
+{
+  int xroot = find(x);
+  int yroot = find(y);
+  if (xroot == yroot) {
+    return false;
+  }
+  if (rank[xroot] < rank[yroot]) {
+    std::swap(xroot, yroot);
+  }
+  parent[yroot] = xroot;
+  if (rank[xroot] == rank[yroot]) {
+    rank[xroot]++;
+  }
+  return true;
+}
+
+int anikanov::denseVertices(const EdgeList &edges, std::vector< int > &from, std::vector< int > &to)
+{
+  const size_t n = edges.size();
+  std::vector< uint32_t > keys(2 * n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[2 * i] = toKey(edges.from[i]);
+    keys[2 * i + 1] = toKey(edges.to[i]);
+  }
+  std::vector< uint32_t > order = radixOrder(keys);
+
+  from.resize(n);
+  to.resize(n);
+  int count = 0;
+  for (size_t i = 0; i < order.size(); ++i) {
+    if (i != 0 && keys[order[i]] != keys[order[i - 1]]) {
+      ++count;
+    }
+    std::vector< int > &side = (order[i] % 2 == 0) ? from : to;
+    side[order[i] / 2] = count;
+  }
+  return order.empty() ? 0 : count + 1;
+}
+
+int anikanov::countVertices(const EdgeList &edges)
+{
+  std::vector< int > from;
+  std::vector< int > to;
+  return denseVertices(edges, from, to);
+}
+
+void anikanov::sortByWeight(EdgeList &edges)
+{
+  const size_t n = edges.size();
+  if (n < 2) {
+    return;
+  }
+  std::vector< uint32_t > keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = toKey(edges.weight[i]);
+  }
+  std::vector< uint32_t > order = radixOrder(keys);
+
+  EdgeList sorted;
+  sorted.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    sorted.push_back(edges.from[order[i]], edges.to[order[i]], edges.weight[order[i]]);
+  }
+  std::swap(edges, sorted);
+}
+
+anikanov::EdgeList anikanov::kruskalMST(const EdgeList &sorted)
+{
+  EdgeList result;
+  std::vector< int > from;
+  std::vector< int > to;
+  int V = denseVertices(sorted, from, to);
+  if (V <= 0) {
+    return result;
+  }
+  DisjointSets sets(V);
+  result.reserve(V - 1);
+  for (size_t i = 0; i < sorted.size() && result.size() + 1 < static_cast< size_t >(V); ++i) {
+    if (sets.merge(from[i], to[i])) {
+      result.push_back(sorted.from[i], sorted.to[i], sorted.weight[i]);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,35 @@
+#ifndef KRUSKAL_HPP
+#define KRUSKAL_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace anikanov {
+  struct EdgeList {
+    std::vector< int > from;
+    std::vector< int > to;
+    std::vector< int > weight;
+
+    size_t size() const;
+    void reserve(size_t count);
+    void push_back(int a, int b, int w);
+    void clear();
+  };
+
+  class DisjointSets {
+  public:
+    explicit DisjointSets(size_t count);
+    int find(int i);
+    bool merge(int x, int y);
+  private:
+    std::vector< int > parent;
+    std::vector< unsigned char > rank;
+  };
+
+  int denseVertices(const EdgeList &edges, std::vector< int > &from, std::vector< int > &to);
+  int countVertices(const EdgeList &edges);
+  void sortByWeight(EdgeList &edges);
+  EdgeList kruskalMST(const EdgeList &sorted);
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include "changeMenuScene.hpp"
 #include "runMatrixScene.hpp"
 #include "graphMenuScene.hpp"
+#include "runStreamScene.hpp"
 
 using namespace anikanov;
 
@@ -18,6 +19,7 @@ int main()
   sceneManager->addScene("ChangeMenu", std::make_unique< ChangeMenuScene >(sceneManager));
   sceneManager->addScene("MatrixMenu", std::make_unique< RunMatrixScene >(sceneManager));
   sceneManager->addScene("GraphMenu", std::make_unique< GraphMenuScene >(sceneManager));
+  sceneManager->addScene("StreamMenu", std::make_unique< RunStreamScene >(sceneManager));
 
   sceneManager->switchToScene("MainMenu");
 
@@ -48,6 +48,8 @@ void anikanov::MainMenuScene::update()
     } else {
       manager->switchToScene("GraphMenu");
     }
+  } else if (command == "/stream") {
+    manager->switchToScene("StreamMenu");
   } else if (command == "/exit") {
     manager->stopRunning();
   }
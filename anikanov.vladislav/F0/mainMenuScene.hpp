@@ -28,6 +28,7 @@ namespace anikanov {
         command{"/change", "change input/output type"},
         command{"/save", "save last output if it exists"},
         command{"/run", "start graph input and Kruskal's algorithm"},
+        command{"/stream", "read a sparse edge list as a stream and run Kruskal's algorithm with timing"},
         command{"/exit", "exit program"},
     };
   };
@@ -5,6 +5,8 @@
 #include <fstream>
 #include <list.hpp>
 
+#include "kruskal.hpp"
+
 bool anikanov::checkMatrix(List< List< int > > &matrix)
 {
   int n = matrix.size();
@@ -42,73 +44,32 @@ anikanov::List< anikanov::List< int > > anikanov::getEdges(List< List< int > > &
   return edges;
 }
 
-int anikanov::findParent(List< int > &parent, int i)
-{
-  if (parent[i] != i) {
-    parent[i] = findParent(parent, parent[i]);
-  }
-  return parent[i];
-}
-
-void anikanov::merge(List< int > &parent, List< int > &rank, int x, int y)
+anikanov::List< anikanov::List< int > > anikanov::runKruskalMST(List< List< int > > &edges)
 {
-  int xroot = findParent(parent, x);
-  int yroot = findParent(parent, y);
-
-  if (rank[xroot] < rank[yroot]) {
-    parent[xroot] = yroot;
-  } else if (rank[xroot] > rank[yroot]) {
-    parent[yroot] = xroot;
-  } else {
-    parent[yroot] = xroot;
-    rank[xroot]++;
+  EdgeList list;
+  list.reserve(edges.size());
+  for (auto &edge: edges) {
+    list.push_back(edge[0], edge[1], edge[2]);
   }
-}
 
-anikanov::List< anikanov::List< int > > anikanov::runKruskalMST(List< List< int > > &edges, int V)
-{
+  sortByWeight(list);
+  EdgeList tree = kruskalMST(list);
   List< List< int > > result;
-
-  edges.sort([](List< int > a, List< int > b){
-    return a[2] < b[2];
-  });
-
-  List< int > parent;
-  for (int i = 0; i < V; ++i){
-    parent.push_back(0);
+  for (size_t i = 0; i < tree.size(); ++i) {
+    result.push_back(List< int >{tree.from[i], tree.to[i], tree.weight[i]});
   }
-  List< int > rank(V, 0);
-
-  for (int v = 0; v < V; ++v) {
-    parent[v] = v;
-  }
-
-  for (auto &edge: edges) {
-    int x = findParent(parent, edge[0]);
-    int y = findParent(parent, edge[1]);
-
-    if (x != y) {
-      result.push_back(edge);
-      merge(parent, rank, x, y);
-    }
-  }
-
   return result;
 }
 
 int anikanov::findNumberOfVertices(List< List< int > > &edges)
 {
-  List< int > vertices;
+  int maxVertex = -1;
 
   for (auto &edge: edges) {
-    vertices.push_back(edge[0]);
-    vertices.push_back(edge[1]);
+    maxVertex = std::max(maxVertex, std::max(edge[0], edge[1]));
   }
 
-  std::sort(vertices.begin(), vertices.end());
-  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
-
-  return vertices.size();
+  return maxVertex + 1;
 }
 
 anikanov::List< anikanov::List< int > > anikanov::toMatrix(List< List< int > > &edges)
@@ -116,7 +77,7 @@ anikanov::List< anikanov::List< int > > anikanov::toMatrix(List< List< int > > &
   int n = findNumberOfVertices(edges);
   List< List< int > > matrix;
   for (int i = 0; i < n; ++i){
-    matrix.push_back(List< int >(n, 0));
+    matrix.push_back(List< int >(0, n));
   }
 
   for (auto &edge: edges) {
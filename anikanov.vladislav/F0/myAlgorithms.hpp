@@ -13,9 +13,7 @@ namespace anikanov {
   List< List< int > > toMatrix(List< List< int > > &edges);
   void printAns(matrix_t &edges, const int sum, const std::shared_ptr<SceneManager> &manager);
 
-  int findParent(List< int > &parent, int i);
-  List< List< int > > runKruskalMST(List< List< int > > &edges, int V);
-  void merge(List< int > &parent, List< int > &rank, int x, int y);
+  List< List< int > > runKruskalMST(List< List< int > > &edges);
 }
 
 #endif
@@ -98,7 +98,7 @@ void anikanov::RunMatrixScene::onClose()
 
   if (!manager->isRunning()) {
     List< List< int > > edges = getEdges(matrix);
-    auto answer = runKruskalMST(edges, matrix.size());
+    auto answer = runKruskalMST(edges);
 
     int sum = std::accumulate(answer.begin(), answer.end(), 0, [](int sum, List< int > &edge) {
       return sum + edge[2];
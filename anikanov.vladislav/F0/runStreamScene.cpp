@@ -0,0 +1,138 @@
+#include "runStreamScene.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace {
+  double toMilliseconds(std::chrono::steady_clock::duration duration)
+  {
+    return std::chrono::duration< double, std::milli >(duration).count();
+  }
+
+  void printTree(const anikanov::EdgeList &tree, long long sum, std::ostream &out)
+  {
+    for (size_t i = 0; i < tree.size(); ++i) {
+      out << tree.from[i] << " " << tree.to[i] << " " << tree.weight[i] << " \n";
+    }
+    out << "\nMin sum:  " << sum << "\n";
+  }
+}
+
+void anikanov::RunStreamScene::onCreate()
+{
+  edges.clear();
+  readTime = std::chrono::steady_clock::duration::zero();
+  auto manager = this->manager.lock();
+  std::ostream *out = &manager->getOutputStream();
+  *out << sceneName << "\n";
+  *out << "Enter the edges as \"from to weight\", the answer is printed as an edge list:" << "\n";
+  help(true);
+}
+
+void anikanov::RunStreamScene::update()
+{
+  auto manager = this->manager.lock();
+  std::istream *in = &manager->getInputStream();
+  std::ostream *out = &manager->getOutputStream();
+
+  auto start = std::chrono::steady_clock::now();
+  std::string command = "";
+  while (*in >> command) {
+    if (command == "/end") {
+      break;
+    } else if (command == "/back") {
+      readTime += std::chrono::steady_clock::now() - start;
+      *out << "Are you sure? [Y/N]: ";
+      do {
+        *in >> command;
+        if (command == "Y") {
+          return manager->switchToScene("MainMenu");
+        } else if (command == "N") {
+          return;
+        } else {
+          *out << "Unexpected answer.\nAre you sure? [Y/N]: ";
+        }
+      } while (*in && command != "Y" && command != "N");
+      return;
+    }
+
+    int b = 0;
+    int c = 0;
+    try {
+      size_t pos = 0;
+      int a = std::stoi(command, &pos);
+      if (pos == command.size() && *in >> b >> c && a >= 0 && b >= 0) {
+        edges.push_back(a, b, c);
+        continue;
+      }
+    } catch (const std::exception &) {
+    }
+    *out << "Invalid input.\n";
+    *out << "correct: 1 2 10\n";
+    in->clear();
+    in->ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+  }
+  readTime += std::chrono::steady_clock::now() - start;
+  manager->stopRunning();
+}
+
+void anikanov::RunStreamScene::onClose()
+{
+  auto manager = this->manager.lock();
+  if (manager->isRunning()) {
+    return;
+  }
+  std::ostream *out = &manager->getOutputStream();
+
+  auto sortStart = std::chrono::steady_clock::now();
+  sortByWeight(edges);
+  auto treeStart = std::chrono::steady_clock::now();
+  EdgeList tree = kruskalMST(edges);
+  auto treeEnd = std::chrono::steady_clock::now();
+
+  long long sum = 0;
+  for (size_t i = 0; i < tree.size(); ++i) {
+    sum += tree.weight[i];
+  }
+
+  printTree(tree, sum, *out);
+  if (manager->getSettings().saveOutput) {
+    std::ofstream fileOut("out.txt");
+    if (!fileOut.is_open()) {
+      *out << "Error on opening file.\n";
+    } else {
+      printTree(tree, sum, fileOut);
+    }
+  }
+
+  *out << "Edges read: " << edges.size() << ", vertices: " << countVertices(edges) << "\n";
+  *out << "Reading time: " << toMilliseconds(readTime) << " ms\n";
+  *out << "Sorting time: " << toMilliseconds(treeStart - sortStart) << " ms\n";
+  *out << "Kruskal time: " << toMilliseconds(treeEnd - treeStart) << " ms\n";
+  *out << "Goodbye!\n";
+}
+
+void anikanov::RunStreamScene::help(bool need_description)
+{
+  auto manager = this->manager.lock();
+  std::ostream *out = &manager->getOutputStream();
+  for (const auto &command: commands) {
+    *out << command.first;
+    if (need_description) {
+      *out << " - " << command.second;
+    }
+    *out << "\n";
+  }
+  *out << "\n";
+}
+
+anikanov::List< std::string > anikanov::RunStreamScene::getOnlyCommands() const
+{
+  List< std::string > onlyCommands;
+  for (const auto &command: commands) {
+    onlyCommands.push_back(command.first);
+  }
+  return onlyCommands;
+}
@@ -0,0 +1,36 @@
+#ifndef RUNSTREAMSCENE_HPP
+#define RUNSTREAMSCENE_HPP
+
+#include <chrono>
+#include <iostream>
+#include <list.hpp>
+
+#include "scene.hpp"
+#include "sceneManager.hpp"
+#include "kruskal.hpp"
+
+namespace anikanov {
+  using command = std::pair< std::string, std::string >;
+
+  class RunStreamScene : public Scene {
+  public:
+    RunStreamScene(std::shared_ptr< SceneManager > manager) : Scene(manager)
+    {
+    }
+    void onCreate() override;
+    void update() override;
+    void onClose() override;
+    void help(bool need_description = false);
+    List< std::string > getOnlyCommands() const;
+  private:
+    std::string sceneName = "Kruskal's Algorithm for Finding Minimum Spanning Tree (edge list stream)";
+    EdgeList edges;
+    std::chrono::steady_clock::duration readTime{};
+    List< command > commands{
+        command{"/end", "Finish entering the edge list"},
+        command{"/back", "Enter the main menu"},
+    };
+  };
+}
+
+#endif
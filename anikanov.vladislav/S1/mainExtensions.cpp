@@ -1,27 +1,27 @@
 #include "mainExtensions.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
+#include <vector>
 
-anikanov::List< std::string > anikanov::split(const std::string &str)
+unsigned long long anikanov::parseNumber(const std::string &line, size_t begin, size_t end)
 {
-  anikanov::List< std::string > list;
-  std::string cur = "";
-  for (char pos: str) {
-    if (pos != ' ') {
-      cur += pos;
-    } else if (!cur.empty()) {
-      list.push_back(cur);
-      cur = "";
-    }
+  const char *first = line.c_str() + begin;
+  char *last = nullptr;
+  errno = 0;
+  unsigned long long number = std::strtoull(first, &last, 10);
+  if (last == first || last > line.c_str() + end) {
+    throw std::invalid_argument("stoull");
   }
-  if (!cur.empty()) {
-    list.push_back(cur);
+  if (errno == ERANGE) {
+    throw std::out_of_range("stoull");
   }
-  return list;
+  return number;
 }
 
 void anikanov::inputList(std::unique_ptr< mainList > &lists, std::istream &stream)
 {
-  std::string inputName;
   std::string line;
 
   line = "";
@@ -32,20 +32,20 @@ void anikanov::inputList(std::unique_ptr< mainList > &lists, std::istream &strea
       std::getline(stream, line);
       continue;
     }
-    List< std::string > inputList = split(line);
-    anikanov::list numbers;
-    inputName = inputList[0];
-    inputList.pop(0);
-    for (auto &i: inputList) {
-      numbers.push_back(std::stoull(i));
+    size_t begin = line.find_first_not_of(' ');
+    if (begin == std::string::npos) {
+      throw std::out_of_range("Index out of range");
     }
+    size_t end = std::min(line.find(' ', begin), line.size());
 
-    std::pair< std::string, List< unsigned long long > > listPair;
-    listPair.first = inputName;
-    for (auto num: numbers) {
-      listPair.second.push_back(num);
+    lists->push_back(std::make_pair(line.substr(begin, end - begin), list()));
+    list &numbers = lists->back()->second;
+    begin = line.find_first_not_of(' ', end);
+    while (begin != std::string::npos) {
+      end = std::min(line.find(' ', begin), line.size());
+      numbers.push_back(parseNumber(line, begin, end));
+      begin = line.find_first_not_of(' ', end);
     }
-    lists->push_back(listPair);
     line = "";
     std::getline(stream, line);
   }
@@ -71,40 +71,39 @@ bool anikanov::printNames(const std::unique_ptr< mainList > &lists, std::ostream
 
 anikanov::getSums anikanov::countList(const std::unique_ptr< mainList > &lists, std::ostream &cout)
 {
-  bool finished = false;
-  bool startPrint = false;
-  size_t idx = 0;
+  std::vector< list::ConstIterator > cursors;
+  cursors.reserve(lists->size());
+  for (auto listIter = lists->begin(); listIter != lists->end(); ++listIter) {
+    const list &numbers = listIter->second;
+    if (!numbers.empty()) {
+      cursors.push_back(numbers.begin());
+    }
+  }
+
+  const list::ConstIterator finish(nullptr);
   List< unsigned long long > sums;
   bool badSum = false;
 
-  while (!finished) {
-    finished = true;
-    startPrint = true;
-    for (auto listIter = lists->begin(); listIter != lists->end(); ++listIter) {
-      const auto &list = *listIter;
-      if (idx < list.second.size()) {
-        if (finished) {
-          sums.push_back(0);
-          finished = false;
-        }
-        auto numIter = list.second.begin();
-        for (size_t i = 0; i < idx; ++i) {
-          numIter++;
-        }
-        if (startPrint) {
-          cout << *numIter;
-          startPrint = false;
-        } else {
-          cout << " " << *numIter;
-        }
-        if (*sums.back() + *numIter < std::max(*sums.back(), *numIter)) {
-          badSum = true;
-        }
-        *sums.back() += *numIter;
+  while (!cursors.empty()) {
+    unsigned long long sum = 0;
+    size_t active = 0;
+    for (size_t i = 0; i < cursors.size(); ++i) {
+      unsigned long long num = *cursors[i];
+      if (i != 0) {
+        cout << " ";
+      }
+      cout << num;
+      if (sum + num < std::max(sum, num)) {
+        badSum = true;
+      }
+      sum += num;
+      if (++cursors[i] != finish) {
+        cursors[active++] = cursors[i];
       }
     }
-    cout << (finished ? "" : "\n");
-    idx++;
+    cursors.erase(cursors.begin() + active, cursors.end());
+    sums.push_back(sum);
+    cout << "\n";
   }
 
   return std::make_pair(sums, badSum);
@@ -9,7 +9,7 @@ namespace anikanov {
   using mainList = List< std::pair< std::string, list > >;
   using getSums = std::pair< list, bool >;
 
-  List< std::string > split(const std::string &str);
+  unsigned long long parseNumber(const std::string &line, size_t begin, size_t end);
   void inputList(std::unique_ptr< mainList > &lists, std::istream &stream);
   bool printNames(const std::unique_ptr< mainList > &lists, std::ostream &cout);
   getSums countList(const std::unique_ptr< mainList > &lists, std::ostream &cout);
@@ -1,16 +1,15 @@
 #include <fstream>
 #include <iostream>
 #include <string>
-#include <queue.hpp>
 #include <stack.hpp>
 #include "mainExtension.hpp"
-#include "elementOfExpression.hpp"
+#include "token.hpp"
 
 int main(int argc, char *argv[])
 {
   using namespace anikanov;
   std::string expression;
-  anikanov::Queue< std::shared_ptr< ElementOfExpression > > postfix;
+  anikanov::ExpressionBuffer buffer;
   anikanov::Stack< long long > answers;
   std::ifstream ifstream;
 
@@ -32,8 +31,8 @@ int main(int argc, char *argv[])
     }
 
     try {
-      postfix = toPostfix(expression);
-      answers.push(calculate(postfix));
+      toPostfix(expression, buffer);
+      answers.push(calculate(buffer));
     } catch (const std::logic_error &err) {
       std::cerr << err.what() << "\n";
       return 1;
@@ -4,11 +4,92 @@
 #include <limits>
 #include <algorithm>
 #include <cctype>
-#include <stack.hpp>
+#include <stdexcept>
 #include "elementOfExpression.hpp"
 #include "bracket.hpp"
 #include "operand.hpp"
 
+namespace {
+  bool isSpace(char c)
+  {
+    return std::isspace(static_cast< unsigned char >(c));
+  }
+
+  bool isDigit(char c)
+  {
+    return std::isdigit(static_cast< unsigned char >(c));
+  }
+
+  long long parseNumber(std::string::const_iterator begin, std::string::const_iterator end)
+  {
+    const long long max = std::numeric_limits< long long >::max();
+    long long value = 0;
+    for (; begin != end && isDigit(*begin); ++begin) {
+      long long digit = *begin - '0';
+      if (value > (max - digit) / 10) {
+        throw std::out_of_range("stoll");
+      }
+      value = value * 10 + digit;
+    }
+    return value;
+  }
+
+  long long apply(long long left, long long right, char symbol)
+  {
+    if (symbol == '+') {
+      if (left > 0 && right > std::numeric_limits< long long >::max() - left) {
+        throw std::overflow_error("Overflow error");
+      }
+      return left + right;
+    } else if (symbol == '-') {
+      if (left < 0 && right > std::numeric_limits< long long >::max() + left + 1) {
+        throw std::underflow_error("Underflow error");
+      }
+      return left - right;
+    } else if (symbol == '*') {
+      if (left != 0 && right > std::numeric_limits< long long >::max() / left) {
+        throw std::overflow_error("Overflow error");
+      }
+      return left * right;
+    } else if (symbol == '/') {
+      if (right == 0) {
+        throw std::invalid_argument("Division by zero");
+      }
+      return left / right;
+    } else if (symbol == '%') {
+      if (right == 0) {
+        throw std::invalid_argument("Division by zero");
+      }
+      return (left % right + right) % right;
+    }
+    return 0;
+  }
+
+  anikanov::Token toToken(const anikanov::elementType &element)
+  {
+    using namespace anikanov;
+    if (element->isNumber()) {
+      return Token{ TokenType::NUMBER, std::dynamic_pointer_cast< Operand >(element)->getValue() };
+    }
+    if (element->isBracket()) {
+      return Token{ TokenType::BRACKET, std::dynamic_pointer_cast< Bracket >(element)->isForward() ? '(' : 0 };
+    }
+    return Token{ TokenType::OPERATION, toSymbol(std::dynamic_pointer_cast< Operation >(element)->getValue()) };
+  }
+
+  anikanov::elementType toElement(const anikanov::Token &token)
+  {
+    using namespace anikanov;
+    const std::string symbol = token.payload == 0 ? "" : std::string(1, static_cast< char >(token.payload));
+    if (token.type == TokenType::NUMBER) {
+      return std::make_shared< Operand >(token.payload);
+    } else if (token.type == TokenType::BRACKET) {
+      return std::make_shared< Bracket >(symbol);
+    }
+    return std::make_shared< Operation >(symbol);
+  }
+}
+
 bool anikanov::checkPriority(const elementType &first, const std::shared_ptr< anikanov::Operation > &second)
 {
   if (first->isBracket()) {
@@ -26,112 +107,93 @@ bool anikanov::checkForward(const elementType &element)
   return std::dynamic_pointer_cast< anikanov::Bracket >(element)->isForward();
 }
 
-anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > anikanov::toPostfix(const std::string &exp)
+void anikanov::toPostfix(const std::string &exp, ExpressionBuffer &buffer)
 {
-  using namespace anikanov;
-  Stack< std::shared_ptr< ElementOfExpression > > operators;
-  Queue< std::shared_ptr< ElementOfExpression > > output;
+  std::vector< Token > &operators = buffer.operators;
+  std::vector< Token > &output = buffer.postfix;
+  buffer.clear();
   auto start = exp.begin();
-  std::string token;
 
   while (start != exp.end()) {
-    auto end = std::find_if(start, exp.end(), [](char c) { return std::isspace(c); });
-    token = std::string(start, end);
-    start = std::find_if(end, exp.end(), [](char c) { return !std::isspace(c); });
-
-    if (isdigit(token[0])) {
-      output.push(std::make_shared< Operand >(token));
-    } else if (token[0] == '(') {
-      operators.push(std::make_shared< Bracket >(token));
-    } else if (token[0] == ')') {
-      if (operators.isEmpty()) {
-        throw std::invalid_argument("Invalid expression");
+    auto end = std::find_if(start, exp.end(), isSpace);
+    char first = (start == end) ? '\0' : *start;
+    size_t length = end - start;
+
+    if (isDigit(first)) {
+      output.push_back(Token{ TokenType::NUMBER, parseNumber(start, end) });
+    } else if (first == '(') {
+      operators.push_back(Token{ TokenType::BRACKET, length == 1 ? '(' : 0 });
+    } else if (first == ')') {
+      while (!operators.empty() && !isForward(operators.back())) {
+        output.push_back(operators.back());
+        operators.pop_back();
       }
-      while (!operators.isEmpty() && !checkForward(operators.top())) {
-        output.push(operators.top());
-        operators.pop();
+      if (operators.empty()) {
+        throw std::invalid_argument("Invalid expression");
       }
-      operators.pop();
+      operators.pop_back();
     } else {
-      std::shared_ptr< Operation > operation = std::make_shared< Operation >(token);
-      while (!operators.isEmpty() && checkPriority(operators.top(), operation)) {
-        output.push(operators.top());
-        operators.pop();
+      Token operation{ TokenType::OPERATION, length == 1 ? toSymbol(std::string(1, first)) : 0 };
+      while (!operators.empty() && getPriority(operators.back()) >= getPriority(operation)) {
+        output.push_back(operators.back());
+        operators.pop_back();
       }
-      operators.push(operation);
+      operators.push_back(operation);
     }
+    start = std::find_if_not(end, exp.end(), isSpace);
   }
 
-  while (!operators.isEmpty()) {
-    auto oper = operators.top();
-    if (oper->isBracket()) {
+  while (!operators.empty()) {
+    if (operators.back().type == TokenType::BRACKET) {
       throw std::invalid_argument("Invalid expression");
     }
-    output.push(operators.top());
-    operators.pop();
+    output.push_back(operators.back());
+    operators.pop_back();
   }
-
-  return output;
 }
 
-long long anikanov::calculate(anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > &postfix)
+long long anikanov::calculate(ExpressionBuffer &buffer)
 {
-  using namespace anikanov;
-  Stack< std::shared_ptr< ElementOfExpression > > stack;
-
-  while (!postfix.isEmpty()) {
-    auto element = postfix.front();
-    postfix.pop();
-
-    if (element->isNumber()) {
-      stack.push(element);
-    } else {
-      auto operation = std::dynamic_pointer_cast< Operation >(element);
+  std::vector< long long > &stack = buffer.operands;
+  stack.clear();
 
-      if (stack.getSize() < 2) {
-        throw std::invalid_argument("Invalid expression");
-      }
-
-      auto right = std::dynamic_pointer_cast< Operand >(stack.top())->getValue();
-      stack.pop();
-      auto left = std::dynamic_pointer_cast< Operand >(stack.top())->getValue();
-      stack.pop();
-      long long result = 0;
-
-      if (operation->getValue() == "+") {
-        if (left > 0 && right > std::numeric_limits< long long >::max() - left) {
-          throw std::overflow_error("Overflow error");
-        }
-        result = left + right;
-      } else if (operation->getValue() == "-") {
-        if (left < 0 && right > std::numeric_limits< long long >::max() + left + 1) {
-          throw std::underflow_error("Underflow error");
-        }
-        result = left - right;
-      } else if (operation->getValue() == "*") {
-        if (left != 0 && right > std::numeric_limits< long long >::max() / left) {
-          throw std::overflow_error("Overflow error");
-        }
-        result = left * right;
-      } else if (operation->getValue() == "/") {
-        if (right == 0) {
-          throw std::invalid_argument("Division by zero");
-        }
-        result = left / right;
-      } else if (operation->getValue() == "%") {
-        if (right == 0) {
-          throw std::invalid_argument("Division by zero");
-        }
-        result = (left % right + right) % right;
-      }
-
-      stack.push(std::make_shared< Operand >(result));
+  for (const Token &token : buffer.postfix) {
+    if (token.type == TokenType::NUMBER) {
+      stack.push_back(token.payload);
+      continue;
+    }
+    if (token.type == TokenType::BRACKET || stack.size() < 2) {
+      throw std::invalid_argument("Invalid expression");
     }
+    long long right = stack.back();
+    stack.pop_back();
+    stack.back() = apply(stack.back(), right, static_cast< char >(token.payload));
   }
 
-  if (stack.getSize() != 1) {
+  if (stack.size() != 1) {
     throw std::invalid_argument("Invalid expression");
   }
 
-  return std::dynamic_pointer_cast< Operand >(stack.top())->getValue();
+  return stack.back();
+}
+
+anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > anikanov::toPostfix(const std::string &exp)
+{
+  ExpressionBuffer buffer;
+  toPostfix(exp, buffer);
+  Queue< std::shared_ptr< ElementOfExpression > > output;
+  for (const Token &token : buffer.postfix) {
+    output.push(toElement(token));
+  }
+  return output;
+}
+
+long long anikanov::calculate(anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > &postfix)
+{
+  ExpressionBuffer buffer;
+  while (!postfix.isEmpty()) {
+    buffer.postfix.push_back(toToken(postfix.front()));
+    postfix.pop();
+  }
+  return calculate(buffer);
 }
@@ -5,6 +5,7 @@
 #include "elementOfExpression.hpp"
 #include <queue.hpp>
 #include "operation.hpp"
+#include "token.hpp"
 
 namespace anikanov {
 
@@ -14,6 +15,10 @@ namespace anikanov {
 
   bool checkForward(const elementType &element);
 
+  void toPostfix(const std::string &exp, ExpressionBuffer &buffer);
+
+  long long calculate(ExpressionBuffer &buffer);
+
   anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > toPostfix(const std::string &exp);
 
   long long calculate(anikanov::Queue< std::shared_ptr< anikanov::ElementOfExpression > > &postfix);
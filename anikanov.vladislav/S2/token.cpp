@@ -0,0 +1,49 @@
+#include "token.hpp"
+
+void anikanov::ExpressionBuffer::clear() noexcept
+{
+  postfix.clear();
+  operators.clear();
+  operands.clear();
+}
+
+char anikanov::toSymbol(const std::string &value) noexcept
+{
+  if (value.size() != 1) {
+    return 0;
+  }
+  switch (value[0]) {
+    case '(':
+    case '+':
+    case '-':
+    case '*':
+    case '/':
+    case '%':
+      return value[0];
+    default:
+      return 0;
+  }
+}
+
+bool anikanov::isForward(const Token &token) noexcept
+{
+  return token.type == TokenType::BRACKET && token.payload == '(';
+}
+
+short anikanov::getPriority(const Token &token) noexcept
+{
+  if (token.type != TokenType::OPERATION) {
+    return 0;
+  }
+  switch (token.payload) {
+    case '+':
+    case '-':
+      return 1;
+    case '*':
+    case '/':
+    case '%':
+      return 2;
+    default:
+      return 0;
+  }
+}
@@ -0,0 +1,32 @@
+#ifndef TOKEN_HPP
+#define TOKEN_HPP
+
+#include <string>
+#include <vector>
+
+namespace anikanov {
+  enum class TokenType : unsigned char {
+    NUMBER,
+    BRACKET,
+    OPERATION
+  };
+
+  struct Token {
+    TokenType type;
+    long long payload;
+  };
+
+  struct ExpressionBuffer {
+    std::vector< Token > postfix;
+    std::vector< Token > operators;
+    std::vector< long long > operands;
+
+    void clear() noexcept;
+  };
+
+  char toSymbol(const std::string &value) noexcept;
+  bool isForward(const Token &token) noexcept;
+  short getPriority(const Token &token) noexcept;
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <memory>
 #include <limits>
 #include <stdexcept>
+#include <utility>
 
 namespace anikanov {
   template< typename T >
@@ -26,9 +27,10 @@ namespace anikanov {
     bool empty() const;
     size_t size() const;
     void clear();
-    void swap(const List &other) noexcept;
+    void swap(List &other) noexcept;
     void remove(const T &value);
-    void remove_if(bool(*pred)(T));
+    template< typename Predicate >
+    void remove_if(Predicate pred);
     void reverse();
     void splice(Iterator position, List< T > &other, Iterator first, Iterator last);
     Iterator insert(Iterator pos, const T &value);
@@ -56,8 +58,12 @@ namespace anikanov {
     Iterator merge(Iterator first, Iterator second, Compare comp);
     template<typename Compare >
     Iterator mergeSort(Iterator start, Iterator end, Compare comp);
+    Node *nodeAt(size_t index) const;
+    void resetCursor() const noexcept;
     std::shared_ptr< List::Node > head, tail;
     size_t list_size;
+    mutable Node *cursor;
+    mutable size_t cursor_index;
   };
 }
 
@@ -480,20 +486,23 @@ anikanov::List< T > &anikanov::List< T >::operator=(List< T > &&other) noexcept
 
     head = other.head;
     tail = other.tail;
+    list_size = other.list_size;
 
     other.head = nullptr;
     other.tail = nullptr;
+    other.list_size = 0;
+    other.resetCursor();
   }
   return *this;
 }
 
 template< typename T >
-anikanov::List< T >::List() : head(nullptr), tail(nullptr), list_size(0)
+anikanov::List< T >::List() : head(nullptr), tail(nullptr), list_size(0), cursor(nullptr), cursor_index(0)
 {
 }
 
 template< typename T >
-anikanov::List< T >::List(const List &other): head(nullptr), tail(nullptr), list_size(0)
+anikanov::List< T >::List(const List &other): head(nullptr), tail(nullptr), list_size(0), cursor(nullptr), cursor_index(0)
 {
   auto current = other.head;
   while (current != nullptr) {
@@ -511,10 +520,13 @@ anikanov::List< T >::List(List &&other) noexcept
   other.head = nullptr;
   other.tail = nullptr;
   other.list_size = 0;
+  cursor = nullptr;
+  cursor_index = 0;
+  other.resetCursor();
 }
 
 template< typename T >
-anikanov::List< T >::List(const T &value, size_t count): head(nullptr), tail(nullptr), list_size(0)
+anikanov::List< T >::List(const T &value, size_t count): head(nullptr), tail(nullptr), list_size(0), cursor(nullptr), cursor_index(0)
 {
   for (size_t i = 0; i < count; ++i) {
     push_back(value);
@@ -522,7 +534,7 @@ anikanov::List< T >::List(const T &value, size_t count): head(nullptr), tail(nul
 }
 
 template< typename T >
-anikanov::List< T >::List(std::initializer_list< T > init): head(nullptr), tail(nullptr), list_size(0)
+anikanov::List< T >::List(std::initializer_list< T > init): head(nullptr), tail(nullptr), list_size(0), cursor(nullptr), cursor_index(0)
 {
   for (auto &element: init) {
     push_back(element);
@@ -530,7 +542,7 @@ anikanov::List< T >::List(std::initializer_list< T > init): head(nullptr), tail(
 }
 
 template< typename T >
-anikanov::List< T >::List(List::Iterator first, List::Iterator last): head(nullptr), tail(nullptr), list_size(0)
+anikanov::List< T >::List(List::Iterator first, List::Iterator last): head(nullptr), tail(nullptr), list_size(0), cursor(nullptr), cursor_index(0)
 {
   for (; first != last; ++first) {
     push_back(*first);
@@ -572,10 +584,9 @@ void anikanov::List< T >::pop(size_t n)
   if (n >= list_size) {
     throw std::out_of_range("Index out of range");
   }
-  auto current = head;
-  for (size_t i = 0; i < n; ++i) {
-    current = current->next;
-  }
+  Node *node = nodeAt(n);
+  auto current = (node->prev != nullptr) ? node->prev->next : head;
+  resetCursor();
 
   if (current->prev != nullptr) {
     current->prev->next = current->next;
@@ -620,13 +631,17 @@ void anikanov::List< T >::clear()
   }
   head = nullptr;
   tail = nullptr;
+  resetCursor();
 }
 
 template< typename T >
-void anikanov::List< T >::swap(const List &other) noexcept
+void anikanov::List< T >::swap(List &other) noexcept
 {
-  head = std::move(other.head);
-  tail = std::move(other.tail);
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(list_size, other.list_size);
+  resetCursor();
+  other.resetCursor();
 }
 
 template< typename T >
@@ -638,42 +653,42 @@ void anikanov::List< T >::remove(const T &value)
 }
 
 template< typename T >
-void anikanov::List< T >::remove_if(bool(*pred)(T))
+template< typename Predicate >
+void anikanov::List< T >::remove_if(Predicate pred)
 {
   auto current = head;
   while (current != nullptr) {
+    auto next = current->next;
     if (pred(current->data)) {
-      auto toDelete = current;
       if (current->prev != nullptr) {
-        current->prev->next = current->next;
+        current->prev->next = next;
       } else {
-        head = current->next;
+        head = next;
       }
-      if (current->next != nullptr) {
-        current->next->prev = current->prev;
+      if (next != nullptr) {
+        next->prev = current->prev;
       } else {
         tail = current->prev;
       }
-      current = current->next;
-      delete toDelete;
+      current->prev = nullptr;
+      current->next = nullptr;
       --list_size;
-    } else {
-      current = current->next;
     }
+    current = next;
   }
+  resetCursor();
 }
 
 template< typename T >
 void anikanov::List< T >::reverse()
 {
-  List< T > new_list;
-  for (int i = list_size - 1; i > -1; --i) {
-    new_list.push_back((*this)[i]);
-  }
-  (*this).clear();
-  for (int i = 0; i < new_list.size(); ++i) {
-    (*this).push_back(new_list[i]);
+  auto current = head;
+  while (current != nullptr) {
+    std::swap(current->prev, current->next);
+    current = current->prev;
   }
+  std::swap(head, tail);
+  resetCursor();
 }
 
 template< typename T >
@@ -683,22 +698,43 @@ void anikanov::List< T >::splice(List::Iterator position, List< T > &other, List
     return;
   }
 
-  auto current = first;
-  bool extra = false;
-  if (list_size == 0) {
-    (*this).push_back(0);
-    extra = true;
-    position = (*this).begin();
+  auto firstNode = first.get_node();
+  auto lastNode = last.get_node();
+  auto rangeTail = (lastNode != nullptr) ? lastNode->prev : other.tail;
+  size_t count = 1;
+  for (auto current = firstNode; current != rangeTail; current = current->next) {
+    ++count;
   }
 
-  while (current != last) {
-    position = insert(position, *current);
-    position++;
-    current = other.erase(current);
+  if (firstNode->prev != nullptr) {
+    firstNode->prev->next = lastNode;
+  } else {
+    other.head = lastNode;
   }
-  if (extra) {
-    (*this).pop();
+  if (lastNode != nullptr) {
+    lastNode->prev = firstNode->prev;
+  } else {
+    other.tail = firstNode->prev;
   }
+  other.list_size -= count;
+  other.resetCursor();
+
+  auto posNode = position.get_node();
+  auto before = (posNode != nullptr) ? posNode->prev : tail;
+  firstNode->prev = before;
+  rangeTail->next = posNode;
+  if (before != nullptr) {
+    before->next = firstNode;
+  } else {
+    head = firstNode;
+  }
+  if (posNode != nullptr) {
+    posNode->prev = rangeTail;
+  } else {
+    tail = rangeTail;
+  }
+  list_size += count;
+  resetCursor();
 }
 
 template< typename T >
@@ -724,6 +760,7 @@ typename anikanov::List< T >::Iterator anikanov::List< T >::insert(List::Iterato
     }
   }
   ++list_size;
+  resetCursor();
   return Iterator(newNode);
 }
 
@@ -733,10 +770,16 @@ typename anikanov::List< T >::Iterator anikanov::List< T >::erase(List::Iterator
   auto posNode = pos.get_node();
   if (posNode->prev) {
     posNode->prev->next = posNode->next;
+  } else {
+    head = posNode->next;
   }
   if (posNode->next) {
     posNode->next->prev = posNode->prev;
+  } else {
+    tail = posNode->prev;
   }
+  --list_size;
+  resetCursor();
   return Iterator(posNode->next);
 }
 
@@ -760,10 +803,12 @@ typename anikanov::List< T >::Iterator anikanov::List< T >::erase(List::Iterator
     } else {
       tail = current_node->prev;
     }
+    --list_size;
 
     it = next;
   }
 
+  resetCursor();
   return end;
 }
 
@@ -815,12 +860,43 @@ T &anikanov::List< T >::operator[](size_t index)
     throw std::out_of_range("Index out of range");
   }
 
-  auto current = head;
-  for (size_t i = 0; i < index; ++i) {
-    current = current->next;
+  return nodeAt(index)->data;
+}
+
+template< typename T >
+typename anikanov::List< T >::Node *anikanov::List< T >::nodeAt(size_t index) const
+{
+  Node *current = head.get();
+  size_t position = 0;
+  size_t distance = index;
+  if (list_size - 1 - index < distance) {
+    current = tail.get();
+    position = list_size - 1;
+    distance = list_size - 1 - index;
+  }
+  if (cursor != nullptr) {
+    size_t fromCursor = (cursor_index > index) ? cursor_index - index : index - cursor_index;
+    if (fromCursor < distance) {
+      current = cursor;
+      position = cursor_index;
+    }
+  }
+  for (; position < index; ++position) {
+    current = current->next.get();
   }
+  for (; position > index; --position) {
+    current = current->prev.get();
+  }
+  cursor = current;
+  cursor_index = index;
+  return current;
+}
 
-  return current->data;
+template< typename T >
+void anikanov::List< T >::resetCursor() const noexcept
+{
+  cursor = nullptr;
+  cursor_index = 0;
 }
 
 template< typename T >
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../S6/sort.hpp"
+
+namespace
+{
+  using data_t = std::vector< int >;
+  using generator_t = std::function< void (data_t & data, std::mt19937 & random) >;
+
+  template< typename Sort >
+  double measure(data_t & data, Sort sort)
+  {
+    auto start = std::chrono::steady_clock::now();
+    sort(data);
+    std::chrono::duration< double, std::milli > time = std::chrono::steady_clock::now() - start;
+    return time.count();
+  }
+
+  void makeRandom(data_t & data, std::mt19937 & random)
+  {
+    std::generate(data.begin(), data.end(), std::ref(random));
+  }
+
+  void makeSorted(data_t & data, std::mt19937 &)
+  {
+    std::iota(data.begin(), data.end(), 0);
+  }
+
+  void makeReversed(data_t & data, std::mt19937 &)
+  {
+    std::iota(data.rbegin(), data.rend(), 0);
+  }
+
+  void makeSwapped(data_t & data, std::mt19937 & random)
+  {
+    std::iota(data.begin(), data.end(), 0);
+    std::uniform_int_distribution< size_t > index(0, data.size() - 1);
+    for (size_t i = 0; i < data.size() / 100; ++i)
+    {
+      std::swap(data[index(random)], data[index(random)]);
+    }
+  }
+
+  void makeTail(data_t & data, std::mt19937 & random)
+  {
+    std::iota(data.begin(), data.end(), 0);
+    std::shuffle(data.begin() + data.size() * 9 / 10, data.end(), random);
+  }
+
+  void makeBlocks(data_t & data, std::mt19937 & random)
+  {
+    const size_t block = 1000;
+    std::iota(data.begin(), data.end(), 0);
+    std::vector< size_t > order((data.size() + block - 1) / block);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), random);
+    data_t result;
+    result.reserve(data.size());
+    for (size_t i : order)
+    {
+      auto first = data.begin() + i * block;
+      result.insert(result.end(), first, first + std::min(block, data.size() - i * block));
+    }
+    data.swap(result);
+  }
+
+  void makeSawtooth(data_t & data, std::mt19937 &)
+  {
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      data[i] = ((i / 5000) % 2 == 0) ? static_cast< int >(i % 5000) : static_cast< int >(5000 - i % 5000);
+    }
+  }
+}
+
+int main(int argc, char * argv[])
+{
+  using namespace khoroshkin;
+  size_t size = 1000000;
+  try
+  {
+    if (argc > 2)
+    {
+      throw std::invalid_argument("wrong input");
+    }
+    if (argc == 2)
+    {
+      size = std::stoull(argv[1]);
+    }
+  }
+  catch (const std::logic_error &)
+  {
+    std::cerr << "Error: wrong input!\n";
+    return 1;
+  }
+  if (size < 1)
+  {
+    std::cerr << "Error: size must be >0\n";
+    return 1;
+  }
+
+  std::pair< std::string, generator_t > inputs[] = {
+    { "random", makeRandom },
+    { "sorted", makeSorted },
+    { "reversed", makeReversed },
+    { "1% swapped", makeSwapped },
+    { "shuffled tail", makeTail },
+    { "shuffled blocks", makeBlocks },
+    { "sawtooth", makeSawtooth }
+  };
+
+  std::cout << size << " ints, ms\n";
+  std::cout << std::left << std::setw(16) << "input" << std::setw(14) << "stable_sort";
+  std::cout << std::setw(14) << "timSort" << "timSort list\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::mt19937 random(2024);
+  for (auto & input : inputs)
+  {
+    data_t source(size);
+    input.second(source, random);
+
+    data_t expected = source;
+    double stdTime = measure(expected, [](data_t & data)
+    {
+      std::stable_sort(data.begin(), data.end(), std::less< int >{});
+    });
+    data_t actual = source;
+    double timTime = measure(actual, [](data_t & data)
+    {
+      timSort(data.begin(), data.end(), std::less< int >{});
+    });
+    std::list< int > list(source.begin(), source.end());
+    auto start = std::chrono::steady_clock::now();
+    timSort(list.begin(), list.end(), std::less< int >{});
+    std::chrono::duration< double, std::milli > listTime = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(16) << input.first << std::setw(14) << stdTime << std::setw(14) << timTime << listTime.count();
+    if (actual != expected || !std::equal(list.begin(), list.end(), expected.begin()))
+    {
+      std::cout << "  MISMATCH";
+    }
+    std::cout << "\n";
+  }
+  return 0;
+}
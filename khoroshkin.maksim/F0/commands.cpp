@@ -13,7 +13,9 @@ void khoroshkin::helpCmd(std::ostream & out)
   out << " adjacency matrix, list - print in format adjacency list\n";
   out << "5) edge add < u, v > - adding edge between vertexes u and v\n";
   out << "6) edge delete < u, v > - deleting egde between vertexes u and v\n";
-  out << "7) sort topological - printing vertexes of graph in order topological sort\n";
+  out << "7) sort < mode > - printing vertexes of graph in order topological sort, available three options:";
+  out << " topological - depth-first order, kahn - Kahn's order or a cycle if the graph has one,";
+  out << " levels - vertexes grouped by depth, each level can be processed independently\n";
   out << "8) save < filename > - saving result of work in file with passed filename\n";
 }
 
@@ -114,6 +116,41 @@ void khoroshkin::sortCmd(Graph< int > & graph, std::istream & is, std::ostream &
     {
       graph.sortTopological();
     }
+    else if (cmd == "kahn" || cmd == "levels")
+    {
+      std::vector< std::vector< int > > levels;
+      std::vector< int > cycle;
+      if (!graph.sortLevels(levels, cycle))
+      {
+        outCycle(cycle, out);
+      }
+      else if (levels.empty())
+      {
+        out << "Graph is empty!\n";
+      }
+      else if (cmd == "kahn")
+      {
+        for (size_t level = 0; level < levels.size(); level++)
+        {
+          for (size_t i = 0; i < levels[level].size(); i++)
+          {
+            bool isLast = (level + 1 == levels.size()) && (i + 1 == levels[level].size());
+            out << levels[level][i] << (isLast ? "\n" : ", ");
+          }
+        }
+      }
+      else
+      {
+        for (size_t level = 0; level < levels.size(); level++)
+        {
+          out << "Level " << level + 1 << ": ";
+          for (size_t i = 0; i < levels[level].size(); i++)
+          {
+            out << levels[level][i] << ((i + 1 == levels[level].size()) ? "\n" : ", ");
+          }
+        }
+      }
+    }
     else
     {
       outInvalidcommand(out);
@@ -138,6 +175,16 @@ void khoroshkin::outInvalidcommand(std::ostream & out)
   out << "Error: Invalid command!\n";
 }
 
+void khoroshkin::outCycle(const std::vector< int > & cycle, std::ostream & out)
+{
+  out << "Error: graph has a cycle: ";
+  for (auto it = cycle.begin(); it != cycle.end(); it++)
+  {
+    out << *it << " -> ";
+  }
+  out << cycle.front() << "\n";
+}
+
 void khoroshkin::outSuccess(std::ostream & out)
 {
   out << "Successful!";
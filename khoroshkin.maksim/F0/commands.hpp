@@ -2,6 +2,7 @@
 #define COMMANDS_HPP
 
 #include <iosfwd>
+#include <vector>
 #include "graph.hpp"
 
 namespace khoroshkin
@@ -15,6 +16,7 @@ namespace khoroshkin
   void saveCmd(Graph< int > & graph, std::istream & is, std::ostream & out);
 
   void outInvalidcommand(std::ostream & out);
+  void outCycle(const std::vector< int > & cycle, std::ostream & out);
   void outSuccess(std::ostream & out);
 }
 
@@ -4,11 +4,12 @@
 #include <iostream>
 #include <algorithm>
 #include <utility>
+#include <vector>
 #include <tree.hpp>
-#include <stack.hpp>
 #include <list.hpp>
 #include "delimiter.hpp"
 #include "datastruct.hpp"
+#include "topologicalSort.hpp"
 
 namespace khoroshkin
 {
@@ -29,13 +30,12 @@ namespace khoroshkin
     void printAdjMatrix();
 
     std::string sortTopological(bool returnLikeStr = false);
+    bool sortLevels(std::vector< std::vector< T > > & levels, std::vector< T > & cycle);
   private:
     Tree< T, List< T > > graph;
 
     void deleteIfVertexUseless(const T & vertex);
-
-    bool checkInVisited(const T & vertex, const List< T > & visited);
-    void sortRecursive(const T & vertex, List< T > & graphList, List< T > & visited, Stack< T > & stack);
+    std::vector< T > compact(Adjacency & adjacency);
   };
 
   template< typename T >
@@ -73,26 +73,7 @@ void khoroshkin::Graph< T >::egdeAdd(const T & startPoint, const T & endPoint)
 
   if (graph.getSize() != 0)
   {
-    bool startAlreadyExist = false;
-    for (auto it1 = graph.begin(); it1 != graph.end(); it1++)
-    {
-      for (auto it2 = (*it1).second.begin(); it2 != (*it1).second.end(); it2++)
-      {
-        if (*it2 == startPoint)
-        {
-          startAlreadyExist = true;
-        }
-      }
-
-      if ((*it1).first == startPoint)
-      {
-        startAlreadyExist = true;
-      }
-      if (graph.find(endPoint) != graph.end())
-      {
-        startAlreadyExist = true;
-      }
-    }
+    bool startAlreadyExist = graph.find(startPoint) != graph.end() || graph.find(endPoint) != graph.end();
     if (!startAlreadyExist)
     {
       throw std::invalid_argument("Error: stick your vertexes to existed graph!\n");
@@ -249,79 +230,89 @@ void khoroshkin::Graph< T >::printAdjMatrix()
 }
 
 template< typename T >
-std::string khoroshkin::Graph< T >::sortTopological(bool retunLikeString)
+std::vector< T > khoroshkin::Graph< T >::compact(Adjacency & adjacency)
 {
-  if (graph.isEmpty())
+  std::vector< T > vertexes;
+  vertexes.reserve(graph.getSize());
+  for (auto it = graph.begin(); it != graph.end(); it++)
   {
-    std::cout << "Graph is empty!\n";
-    return "";
+    vertexes.push_back((*it).first);
   }
 
-  List< std::pair< T, List< T > > > graphList{};
+  adjacency.offsets.assign(1, 0);
+  adjacency.offsets.reserve(vertexes.size() + 1);
+  adjacency.targets.clear();
   for (auto it = graph.begin(); it != graph.end(); it++)
   {
-    graphList.push_back(*it);
+    for (auto inList = (*it).second.begin(); inList != (*it).second.end(); inList++)
+    {
+      auto target = std::lower_bound(vertexes.begin(), vertexes.end(), *inList);
+      adjacency.targets.push_back(target - vertexes.begin());
+    }
+    adjacency.offsets.push_back(adjacency.targets.size());
   }
+  return vertexes;
+}
 
-  Stack< T > stack;
-  List< T > visitedVerts;
-  for (auto it = graphList.begin(); it != graphList.end(); ++it)
+template< typename T >
+std::string khoroshkin::Graph< T >::sortTopological(bool retunLikeString)
+{
+  if (graph.isEmpty())
   {
-    if (!checkInVisited((*it).first, visitedVerts))
-    {
-      sortRecursive((*it).first, (*it).second, visitedVerts, stack);
-    }
+    std::cout << "Graph is empty!\n";
+    return "";
   }
 
+  Adjacency adjacency;
+  std::vector< T > vertexes = compact(adjacency);
+  std::vector< size_t > order = sortDepthFirst(adjacency);
+
   std::string result = "";
-  if (!retunLikeString)
+  for (auto it = order.begin(); it != order.end(); it++)
   {
-    while (!stack.isEmpty())
+    const char * separator = (it + 1 == order.end()) ? "\n" : ", ";
+    if (!retunLikeString)
     {
-      std::cout << stack.top();
-      stack.pop();
-      std::cout << ((stack.isEmpty()) ? "\n" : ", ");
+      std::cout << vertexes[*it] << separator;
     }
-  }
-  else
-  {
-    while (!stack.isEmpty())
+    else
     {
-      result.append(std::to_string(stack.top()));
-      stack.pop();
-      result.append(((stack.isEmpty()) ? "\n" : ", "));
+      result.append(std::to_string(vertexes[*it]));
+      result.append(separator);
     }
   }
   return result;
 }
 
 template< typename T >
-bool khoroshkin::Graph< T >::checkInVisited(const T & vertex, const List< T > & visited)
+bool khoroshkin::Graph< T >::sortLevels(std::vector< std::vector< T > > & levels, std::vector< T > & cycle)
 {
-  for (auto it = visited.begin(); it != visited.end(); it++)
+  levels.clear();
+  cycle.clear();
+  Adjacency adjacency;
+  std::vector< T > vertexes = compact(adjacency);
+  KahnOrder sorted = sortKahn(adjacency);
+
+  if (!sorted.cycle.empty())
   {
-    if (*it == vertex)
+    for (auto it = sorted.cycle.begin(); it != sorted.cycle.end(); it++)
     {
-      return true;
+      cycle.push_back(vertexes[*it]);
     }
+    return false;
   }
-  return false;
-}
 
-template< typename T >
-void khoroshkin::Graph< T >::sortRecursive(const T & vertex, List< T > & graphList, List< T > & visited, Stack< T > & stack)
-{
-  visited.push_back(vertex);
-
-  for (auto it = graphList.begin(); it != graphList.end(); it++)
+  sorted.levelStarts.push_back(sorted.order.size());
+  for (size_t level = 0; level + 1 < sorted.levelStarts.size(); level++)
   {
-    if (!checkInVisited(*it, visited))
+    levels.emplace_back();
+    levels.back().reserve(sorted.levelStarts[level + 1] - sorted.levelStarts[level]);
+    for (size_t i = sorted.levelStarts[level]; i < sorted.levelStarts[level + 1]; i++)
     {
-      sortRecursive(*it, (*graph.find(*it)).second, visited, stack);
+      levels.back().push_back(vertexes[sorted.order[i]]);
     }
   }
-
-  stack.push(vertex);
+  return true;
 }
 
 template< typename T >
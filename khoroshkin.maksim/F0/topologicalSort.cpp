@@ -0,0 +1,122 @@
+#include "topologicalSort.hpp"
+#include <algorithm>
+#include <utility>
+
+size_t khoroshkin::Adjacency::getSize() const
+{
+  return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+std::vector< size_t > khoroshkin::sortDepthFirst(const Adjacency & graph)
+{
+  const size_t size = graph.getSize();
+  std::vector< bool > visited(size, false);
+  std::vector< std::pair< size_t, size_t > > frames;
+  std::vector< size_t > order;
+  order.reserve(size);
+
+  for (size_t root = 0; root < size; root++)
+  {
+    if (visited[root])
+    {
+      continue;
+    }
+    visited[root] = true;
+    frames.emplace_back(root, graph.offsets[root]);
+    while (!frames.empty())
+    {
+      std::pair< size_t, size_t > & frame = frames.back();
+      if (frame.second == graph.offsets[frame.first + 1])
+      {
+        order.push_back(frame.first);
+        frames.pop_back();
+        continue;
+      }
+      size_t next = graph.targets[frame.second++];
+      if (!visited[next])
+      {
+        visited[next] = true;
+        frames.emplace_back(next, graph.offsets[next]);
+      }
+    }
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+khoroshkin::KahnOrder khoroshkin::sortKahn(const Adjacency & graph)
+{
+  const size_t size = graph.getSize();
+  std::vector< size_t > inDegree(size, 0);
+  for (size_t target : graph.targets)
+  {
+    inDegree[target]++;
+  }
+
+  KahnOrder result;
+  result.order.reserve(size);
+  for (size_t i = 0; i < size; i++)
+  {
+    if (inDegree[i] == 0)
+    {
+      result.order.push_back(i);
+    }
+  }
+
+  size_t levelBegin = 0;
+  while (levelBegin != result.order.size())
+  {
+    size_t levelEnd = result.order.size();
+    result.levelStarts.push_back(levelBegin);
+    for (size_t i = levelBegin; i < levelEnd; i++)
+    {
+      size_t vertex = result.order[i];
+      for (size_t edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; edge++)
+      {
+        if (--inDegree[graph.targets[edge]] == 0)
+        {
+          result.order.push_back(graph.targets[edge]);
+        }
+      }
+    }
+    levelBegin = levelEnd;
+  }
+
+  if (result.order.size() == size)
+  {
+    return result;
+  }
+
+  std::vector< size_t > predecessor(size, size);
+  for (size_t vertex = 0; vertex < size; vertex++)
+  {
+    for (size_t edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; edge++)
+    {
+      if (inDegree[vertex] != 0 && inDegree[graph.targets[edge]] != 0)
+      {
+        predecessor[graph.targets[edge]] = vertex;
+      }
+    }
+  }
+
+  size_t current = 0;
+  while (inDegree[current] == 0)
+  {
+    current++;
+  }
+  std::vector< bool > seen(size, false);
+  while (!seen[current])
+  {
+    seen[current] = true;
+    current = predecessor[current];
+  }
+  size_t start = current;
+  do
+  {
+    result.cycle.push_back(current);
+    current = predecessor[current];
+  }
+  while (current != start);
+  std::reverse(result.cycle.begin(), result.cycle.end());
+  return result;
+}
@@ -0,0 +1,28 @@
+#ifndef TOPOLOGICALSORT_HPP
+#define TOPOLOGICALSORT_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace khoroshkin
+{
+  struct Adjacency
+  {
+    std::vector< size_t > offsets;
+    std::vector< size_t > targets;
+
+    size_t getSize() const;
+  };
+
+  struct KahnOrder
+  {
+    std::vector< size_t > order;
+    std::vector< size_t > levelStarts;
+    std::vector< size_t > cycle;
+  };
+
+  std::vector< size_t > sortDepthFirst(const Adjacency & graph);
+  KahnOrder sortKahn(const Adjacency & graph);
+}
+
+#endif
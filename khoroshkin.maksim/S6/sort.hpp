@@ -5,113 +5,238 @@
 #include <algorithm>
 #include <utility>
 #include <iterator>
-#include "list.hpp"
+#include <vector>
 
 namespace khoroshkin
 {
+  template< typename ForwardIt >
+  struct Run
+  {
+    ForwardIt first;
+    ForwardIt last;
+    size_t length;
+  };
+
   template< typename ForwardIt, typename Compare >
-  void selectionSort(ForwardIt first, ForwardIt last, Compare comp);
+  void binaryInsertionSort(ForwardIt first, ForwardIt sortedLast, ForwardIt last, Compare comp);
 
-  template< typename ForwardItIt, typename Compare >
-  void mergeRuns(ForwardItIt first1, ForwardItIt last1, ForwardItIt first2, ForwardItIt last2, Compare comp);
+  template< typename ForwardIt, typename Buffer, typename Compare >
+  ForwardIt countRun(ForwardIt first, ForwardIt last, size_t & length, Buffer & buffer, Compare comp);
 
-  template< typename ForwardItIt, typename Compare >
-  void timSort(ForwardItIt first, ForwardItIt last, Compare comp);
+  template< typename ForwardIt, typename Predicate >
+  size_t gallop(ForwardIt first, size_t length, Predicate pred);
 
-  int getMinrun(int N);
+  template< typename ForwardIt, typename Buffer, typename Compare >
+  void mergeRuns(ForwardIt first, ForwardIt middle, size_t lengthB, Buffer & buffer, size_t & minGallop, Compare comp);
+
+  template< typename ForwardIt, typename Buffer, typename Compare >
+  void mergeAt(std::vector< Run< ForwardIt > > & runs, size_t i, Buffer & buffer, size_t & minGallop, Compare comp);
+
+  template< typename ForwardIt, typename Compare >
+  void timSort(ForwardIt first, ForwardIt last, Compare comp);
+
+  size_t getMinrun(size_t N);
 
   template< typename BiderectIt, typename Compare >
   void shellSort(BiderectIt first, BiderectIt last, Compare comp);
+
+  const size_t MIN_GALLOP = 7;
 }
 
 template< typename ForwardIt, typename Compare >
-void khoroshkin::selectionSort(ForwardIt first, ForwardIt last, Compare comp)
+void khoroshkin::binaryInsertionSort(ForwardIt first, ForwardIt sortedLast, ForwardIt last, Compare comp)
 {
-  if (comp(1,2))
+  for (auto current = sortedLast; current != last; ++current)
+  {
+    auto position = std::upper_bound(first, current, *current, comp);
+    std::rotate(position, current, std::next(current));
+  }
+}
+
+template< typename ForwardIt, typename Buffer, typename Compare >
+ForwardIt khoroshkin::countRun(ForwardIt first, ForwardIt last, size_t & length, Buffer & buffer, Compare comp)
+{
+  auto previous = first;
+  auto current = std::next(first);
+  length = 1;
+  if (current == last)
+  {
+    return current;
+  }
+  if (comp(*current, *previous))
   {
-    for (auto i = first; i != last; ++i)
+    while (current != last && comp(*current, *previous))
     {
-      std::iter_swap(i, std::min_element(i, last));
+      previous = current++;
+      ++length;
     }
+    buffer.assign(std::make_move_iterator(first), std::make_move_iterator(current));
+    std::move(buffer.rbegin(), buffer.rend(), first);
   }
   else
   {
-    for (auto i = first; i != last; ++i)
-  {
-    std::iter_swap(i, std::max_element(i, last));
-  }
+    while (current != last && !comp(*current, *previous))
+    {
+      previous = current++;
+      ++length;
+    }
   }
+  return current;
 }
 
-template< typename ForwardIt, typename Compare >
-void khoroshkin::mergeRuns(ForwardIt first1, ForwardIt last1, ForwardIt first2, ForwardIt last2, Compare comp)
+template< typename ForwardIt, typename Predicate >
+size_t khoroshkin::gallop(ForwardIt first, size_t length, Predicate pred)
 {
-  List< double > fRange{ first1, last1 };
-  List< double > sRange{ first2, last2 };
-  auto fIt = fRange.begin();
-  auto sIt = sRange.begin();
-  while (fIt != fRange.end() && sIt != sRange.end())
+  size_t passed = 0;
+  size_t step = 1;
+  while (passed + step <= length)
   {
-    if (comp(*fIt, *sIt))
+    auto probe = std::next(first, step - 1);
+    if (!pred(*probe))
     {
-      *first1 = *fIt;
-      first1++;
-      fIt++;
-    }
-    else
-    {
-      *first1 = *sIt;
-      first1++;
-      sIt++;
+      return passed + std::distance(first, std::partition_point(first, probe, pred));
     }
+    passed += step;
+    first = std::next(probe);
+    step *= 2;
   }
-  for (;fIt != fRange.end(); ++fIt)
+  return passed + std::distance(first, std::partition_point(first, std::next(first, length - passed), pred));
+}
+
+template< typename ForwardIt, typename Buffer, typename Compare >
+void khoroshkin::mergeRuns(ForwardIt first, ForwardIt middle, size_t lengthB, Buffer & buffer, size_t & minGallop, Compare comp)
+{
+  using value_type = typename std::iterator_traits< ForwardIt >::value_type;
+  first = std::upper_bound(first, middle, *middle, comp);
+  if (first == middle)
   {
-    *first1 = *fIt;
-    first1++;
+    return;
   }
-  for (;sIt != sRange.end(); ++sIt)
+  buffer.assign(std::make_move_iterator(first), std::make_move_iterator(middle));
+  auto aIt = buffer.begin();
+  auto bIt = middle;
+  auto dest = first;
+  size_t remainingB = lengthB;
+  while (aIt != buffer.end() && remainingB != 0)
   {
-    *first1 = *sIt;
-    first1++;
+    size_t winsA = 0;
+    size_t winsB = 0;
+    while (aIt != buffer.end() && remainingB != 0 && winsA < minGallop && winsB < minGallop)
+    {
+      if (comp(*bIt, *aIt))
+      {
+        *dest++ = std::move(*bIt++);
+        --remainingB;
+        ++winsB;
+        winsA = 0;
+      }
+      else
+      {
+        *dest++ = std::move(*aIt++);
+        ++winsA;
+        winsB = 0;
+      }
+    }
+    while (aIt != buffer.end() && remainingB != 0)
+    {
+      const value_type & keyB = *bIt;
+      size_t countA = gallop(aIt, buffer.end() - aIt, [&](const value_type & x) { return !comp(keyB, x); });
+      dest = std::move(aIt, aIt + countA, dest);
+      aIt += countA;
+      if (aIt == buffer.end())
+      {
+        break;
+      }
+      const value_type & keyA = *aIt;
+      size_t countB = gallop(bIt, remainingB, [&](const value_type & x) { return comp(x, keyA); });
+      auto bNext = std::next(bIt, countB);
+      dest = std::move(bIt, bNext, dest);
+      bIt = bNext;
+      remainingB -= countB;
+      if (minGallop > 1)
+      {
+        --minGallop;
+      }
+      if (countA < MIN_GALLOP && countB < MIN_GALLOP)
+      {
+        minGallop += 2;
+        break;
+      }
+    }
   }
+  std::move(aIt, buffer.end(), dest);
+}
+
+template< typename ForwardIt, typename Buffer, typename Compare >
+void khoroshkin::mergeAt(std::vector< Run< ForwardIt > > & runs, size_t i, Buffer & buffer, size_t & minGallop, Compare comp)
+{
+  mergeRuns(runs[i].first, runs[i + 1].first, runs[i + 1].length, buffer, minGallop, comp);
+  runs[i].last = runs[i + 1].last;
+  runs[i].length += runs[i + 1].length;
+  runs.erase(runs.begin() + i + 1);
 }
 
 template< typename ForwardIt, typename Compare >
 void khoroshkin::timSort(ForwardIt first, ForwardIt last, Compare comp)
 {
-  size_t size = std::distance(first, last);
-  size_t minrun = getMinrun(size);
-  auto savedFirst = first;
+  using value_type = typename std::iterator_traits< ForwardIt >::value_type;
+  size_t remaining = std::distance(first, last);
+  if (remaining < 2)
+  {
+    return;
+  }
+  size_t minrun = getMinrun(remaining);
+  std::vector< value_type > buffer;
+  std::vector< Run< ForwardIt > > runs;
+  size_t minGallop = MIN_GALLOP;
   while (first != last)
   {
-    auto sortFrom = first;
-    for (size_t i = 0; first != last && i < minrun; ++i)
+    size_t length = 0;
+    auto runLast = countRun(first, last, length, buffer, comp);
+    if (length < minrun)
     {
-      first++;
+      size_t forced = std::min(minrun, remaining);
+      auto forcedLast = std::next(runLast, forced - length);
+      binaryInsertionSort(first, runLast, forcedLast, comp);
+      runLast = forcedLast;
+      length = forced;
     }
-    selectionSort(sortFrom, first, comp);
-  }
-  while (savedFirst != last)
-  {
-    auto mergeFrom = savedFirst;
-    for (size_t i = 0; savedFirst != last && i < minrun; ++i)
+    runs.push_back({ first, runLast, length });
+    remaining -= length;
+    first = runLast;
+
+    while (runs.size() > 1)
     {
-      savedFirst++;
+      size_t n = runs.size() - 2;
+      if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length)
+        || (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length))
+      {
+        if (runs[n - 1].length < runs[n + 1].length)
+        {
+          --n;
+        }
+      }
+      else if (runs[n].length > runs[n + 1].length)
+      {
+        break;
+      }
+      mergeAt(runs, n, buffer, minGallop, comp);
     }
-    auto mergeTo = savedFirst;
-    auto secondMergeFrom = savedFirst;
-    for (size_t i = 0; savedFirst != last && i < minrun; ++i)
+  }
+  while (runs.size() > 1)
+  {
+    size_t n = runs.size() - 2;
+    if (n > 0 && runs[n - 1].length < runs[n + 1].length)
     {
-      savedFirst++;
+      --n;
     }
-    mergeRuns(mergeFrom, mergeTo, secondMergeFrom, savedFirst, comp);
+    mergeAt(runs, n, buffer, minGallop, comp);
   }
 }
 
-int khoroshkin::getMinrun(int N)
+size_t khoroshkin::getMinrun(size_t N)
 {
-  int addition = 0;
+  size_t addition = 0;
   while (N >= 64)
   {
     addition |= (N & 1);
@@ -259,7 +259,8 @@ khoroshkin::List< T >::List() :
 {}
 
 template< typename T >
-khoroshkin::List< T >::List(size_t count, const T & value)
+khoroshkin::List< T >::List(size_t count, const T & value) :
+  size(0), head(nullptr)
 {
   for (size_t i = 0; i < count; ++i)
   {
@@ -279,7 +280,8 @@ khoroshkin::List< T >::List(Iter begin, Iter end) :
 }
 
 template< typename T >
-khoroshkin::List< T >::List(std::initializer_list< T > init)
+khoroshkin::List< T >::List(std::initializer_list< T > init) :
+  size(0), head(nullptr)
 {
   for (auto it = init.begin(); it != init.end(); ++it)
   {
@@ -288,7 +290,8 @@ khoroshkin::List< T >::List(std::initializer_list< T > init)
 }
 
 template< typename T >
-khoroshkin::List< T >::List(const khoroshkin::List< T > & obj)
+khoroshkin::List< T >::List(const khoroshkin::List< T > & obj) :
+  size(0), head(nullptr)
 {
   if (obj.head == nullptr)
   {
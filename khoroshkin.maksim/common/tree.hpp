@@ -536,11 +536,20 @@ size_t khoroshkin::Tree< Key, Value, Comp >::erase(const Key & key)
     if (getHeight(todeleteNode->left) > getHeight(todeleteNode->right))
     {
       Node * toreplace = findMax(todeleteNode->left);
-      (toreplace->parent != todeleteNode) ? toCheckBalance = toreplace->parent : toCheckBalance = todeleteNode->parent;
-      toreplace->parent->right = toreplace->left;
-      if (toreplace->left)
+      if (toreplace->parent != todeleteNode)
+      {
+        toCheckBalance = toreplace->parent;
+        toreplace->parent->right = toreplace->left;
+        if (toreplace->left)
+        {
+          toreplace->left->parent = toreplace->parent;
+        }
+        toreplace->left = todeleteNode->left;
+        toreplace->left->parent = toreplace;
+      }
+      else
       {
-        toreplace->left->parent = toreplace->parent;
+        toCheckBalance = toreplace;
       }
       toreplace->parent = todeleteNode->parent;
       if (toreplace->parent)
@@ -559,11 +568,6 @@ size_t khoroshkin::Tree< Key, Value, Comp >::erase(const Key & key)
       {
         toreplace->right->parent = toreplace;
       }
-      if (todeleteNode->left != toreplace)
-      {
-        toreplace->left = todeleteNode->left;
-        toreplace->left->parent = toreplace;
-      }
       if (todeleteNode == root)
       {
         root = toreplace;
@@ -573,11 +577,20 @@ size_t khoroshkin::Tree< Key, Value, Comp >::erase(const Key & key)
     else
     {
       Node * toreplace = findMin(todeleteNode->right);
-      (toreplace->parent != todeleteNode) ? toCheckBalance = toreplace->parent : toCheckBalance = todeleteNode->parent;
-      toreplace->parent->left = toreplace->right;
-      if (toreplace->right)
+      if (toreplace->parent != todeleteNode)
+      {
+        toCheckBalance = toreplace->parent;
+        toreplace->parent->left = toreplace->right;
+        if (toreplace->right)
+        {
+          toreplace->right->parent = toreplace->parent;
+        }
+        toreplace->right = todeleteNode->right;
+        toreplace->right->parent = toreplace;
+      }
+      else
       {
-        toreplace->right->parent = toreplace->parent;
+        toCheckBalance = toreplace;
       }
       toreplace->parent = todeleteNode->parent;
       if (toreplace->parent)
@@ -596,11 +609,6 @@ size_t khoroshkin::Tree< Key, Value, Comp >::erase(const Key & key)
       {
         toreplace->left->parent = toreplace;
       }
-      if (todeleteNode->right != toreplace)
-      {
-        toreplace->right = todeleteNode->right;
-        toreplace->right->parent = toreplace;
-      }
       if (todeleteNode == root)
       {
         root = toreplace;
@@ -618,68 +626,62 @@ size_t khoroshkin::Tree< Key, Value, Comp >::erase(const Key & key)
 template< typename Key, typename Value, typename Comp >
 void khoroshkin::Tree< Key, Value, Comp >::leftRotate(Node * node)
 {
+  Node * newChild = node->right;
+  node->right = newChild->left;
+  if (newChild->left)
+  {
+    newChild->left->parent = node;
+  }
+  newChild->parent = node->parent;
   if (node->parent)
   {
     Node * parent = node->parent;
-    Node * newChild;
     if (parent->right == node)
     {
-      parent->right = node->right;
-      newChild = parent->right;
+      parent->right = newChild;
     }
     else
     {
-      parent->left = node->right;
-      newChild = parent->left;
+      parent->left = newChild;
     }
-    newChild->parent = parent;
-    node->right = node->right->left;
-    newChild->left = node;
-    node->parent = newChild;
   }
   else
   {
-    Node * temp = node;
-    root = node->right;
-    temp->right = root->right->left;
-    root->left = temp;
-    temp->parent = root;
-    root->parent = nullptr;
+    root = newChild;
   }
+  newChild->left = node;
+  node->parent = newChild;
   updateHeight(root);
 }
 
 template< typename Key, typename Value, typename Comp >
 void khoroshkin::Tree< Key, Value, Comp >::rightRotate(Node * node)
 {
+  Node * newChild = node->left;
+  node->left = newChild->right;
+  if (newChild->right)
+  {
+    newChild->right->parent = node;
+  }
+  newChild->parent = node->parent;
   if (node->parent)
   {
     Node * parent = node->parent;
-    Node * newChild;
     if (parent->left == node)
     {
-      parent->left = node->left;
-      newChild = parent->left;
+      parent->left = newChild;
     }
     else
     {
-      parent->right = node->left;
-      newChild = parent->right;
+      parent->right = newChild;
     }
-    newChild->parent = parent;
-    node->left = node->left->right;
-    newChild->right = node;
-    node->parent = newChild;
   }
   else
   {
-    Node * temp = node;
-    root = node->left;
-    temp->left = root->left->right;
-    root->right = temp;
-    temp->parent = root;
-    root->parent = nullptr;
+    root = newChild;
   }
+  newChild->right = node;
+  node->parent = newChild;
   updateHeight(root);
 }
 
@@ -0,0 +1,34 @@
+#include "allocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  size_t allocations = 0;
+}
+
+size_t kovshikov::getAllocations() noexcept
+{
+  return allocations;
+}
+
+void* operator new(size_t size)
+{
+  ++allocations;
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if(ptr == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
@@ -0,0 +1,10 @@
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+#include <cstddef>
+
+namespace kovshikov
+{
+  size_t getAllocations() noexcept;
+}
+
+#endif
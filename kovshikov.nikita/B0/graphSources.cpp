@@ -0,0 +1,4 @@
+// The Makefile links only the lab's own directory and common,
+// so the F0 graph is compiled into the benchmark from here.
+#include "../F0/orientedGraph.cpp"
+#include "../F0/outMessage.cpp"
@@ -0,0 +1,67 @@
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include "allocationCounter.hpp"
+#include "../F0/orientedGraph.hpp"
+
+namespace
+{
+  using namespace kovshikov;
+
+  void fillDense(Graph& graph, size_t count)
+  {
+    for(size_t i = 1; i <= count; i++)
+    {
+      graph.addVertex(i, "vertex");
+    }
+    for(size_t i = 1; i <= count; i++)
+    {
+      for(size_t j = 1; j <= count; j++)
+      {
+        if(i != j)
+        {
+          graph.createEdge(i, j, 1);
+        }
+      }
+    }
+  }
+
+  void measure(const std::string& name, Graph& graph, const std::function< void(Graph&) >& run)
+  {
+    size_t before = getAllocations();
+    run(graph);
+    std::cout << "  " << name << ": " << getAllocations() - before << "\n";
+  }
+}
+
+int main(int argc, char** argv)
+{
+  size_t defaults[] = { 20, 60 };
+  size_t count = (argc > 1) ? argc - 1 : 2;
+  std::ostream nowhere(nullptr);
+
+  for(size_t i = 0; i < count; i++)
+  {
+    size_t size = (argc > 1) ? std::strtoul(argv[i + 1], nullptr, 10) : defaults[i];
+    if(size < 2)
+    {
+      std::cerr << "Wrong vertex count" << "\n";
+      return 1;
+    }
+    Graph graph;
+    fillDense(graph, size);
+    std::cout << "dense graph, " << size << " vertices, allocations per command:\n";
+    measure("max", graph, [&nowhere](Graph& g) { g.getMax(nowhere); });
+    measure("degree 1", graph, [](Graph& g) { g.getDegree(1); });
+    measure("own 1", graph, [](Graph& g) { g.getOwn(1); });
+    measure("edge", graph, [](Graph& g) { g.getEdges(); });
+    measure("output", graph, [&nowhere](Graph& g) { g.outGraph(nowhere); });
+    measure("connect 1", graph, [size](Graph& g) { g.connect(1, size, 1); });
+    measure("by weight 1", graph, [](Graph& g) {
+      Graph::WeightView view;
+      g.getByWeight(view, 1);
+    });
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include "stack.hpp"
+#include "../S2/computing.hpp"
+
+namespace
+{
+  size_t generateFile(const std::string& name, unsigned long long bytes)
+  {
+    std::ofstream out(name);
+    std::minstd_rand random(2024);
+    std::string line;
+    unsigned long long written = 0;
+    size_t lines = 0;
+    while(written < bytes)
+    {
+      line = "( " + std::to_string(random() % 1000) + " + " + std::to_string(random() % 1000) + " ) * ";
+      line += std::to_string(random() % 100) + " - " + std::to_string(random() % 10000);
+      line += " % " + std::to_string(random() % 97 + 1) + "\n";
+      out << line;
+      written += line.size();
+      lines++;
+    }
+    return lines;
+  }
+
+  std::string getPeakMemory()
+  {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while(std::getline(status, line))
+    {
+      if(line.compare(0, 6, "VmHWM:") == 0)
+      {
+        size_t begin = line.find_first_not_of(" \t", 6);
+        return line.substr(begin);
+      }
+    }
+    return "n/a";
+  }
+}
+
+int main(int argc, char** argv)
+{
+  using namespace kovshikov;
+  unsigned long long megabytes = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1024;
+  std::string fileName = (argc > 2) ? argv[2] : "expressions.txt";
+  if(argc > 3 || megabytes == 0)
+  {
+    std::cerr << "Usage: lab [megabytes] [file]" << "\n";
+    return 1;
+  }
+
+  size_t lines = generateFile(fileName, megabytes * 1024 * 1024);
+  std::cout << "file: " << megabytes << " MB, " << lines << " lines\n";
+  std::cout << "peak memory after generation: " << getPeakMemory() << "\n";
+
+  Stack< long long > result;
+  std::ifstream file(fileName);
+  auto start = std::chrono::steady_clock::now();
+  try
+  {
+    evaluateStream(file, result);
+  }
+  catch(const std::exception& error)
+  {
+    std::cerr << error.what() << "\n";
+    std::remove(fileName.c_str());
+    return 1;
+  }
+  std::chrono::duration< double > time = std::chrono::steady_clock::now() - start;
+  std::remove(fileName.c_str());
+
+  std::cout << "evaluation: " << time.count() << " s, " << (time.count() > 0.0 ? lines / time.count() : 0.0);
+  std::cout << " lines/s\n";
+  std::cout << "peak memory after evaluation: " << getPeakMemory() << "\n";
+  return 0;
+}
@@ -1,11 +1,10 @@
 #include "orientedGraph.hpp"
-#include <algorithm>
+#include <memory>
 #include <functional>
 #include <iostream>
 #include <iterator>
-#include <numeric>
+#include <stdexcept>
 #include "outMessage.hpp"
-#include "sort.hpp"
 
 kovshikov::Graph& kovshikov::Graph::operator=(const Graph& graph)
 {
@@ -30,7 +29,7 @@ kovshikov::Graph::Node& kovshikov::Graph::Node::operator=(const Node& node)
   return *this;
 }
 
-void kovshikov::Graph::haveThisVertex(size_t key)
+void kovshikov::Graph::haveThisVertex(size_t key) const
 {
   if(tree.find(key) == tree.end())
   {
@@ -38,7 +37,7 @@ void kovshikov::Graph::haveThisVertex(size_t key)
   }
 }
 
-void kovshikov::Graph::haveNot(size_t keyWho, size_t keyWith)
+void kovshikov::Graph::haveNot(size_t keyWho, size_t keyWith) const
 {
   bool haveWho = tree.find(keyWho) == tree.end();
   bool haveWith = tree.find(keyWith) == tree.end();
@@ -48,12 +47,12 @@ void kovshikov::Graph::haveNot(size_t keyWho, size_t keyWith)
   }
 }
 
-bool kovshikov::Graph::haveThisKey(size_t key)
+bool kovshikov::Graph::haveThisKey(size_t key) const
 {
   return tree.find(key) != tree.end();
 }
 
-bool kovshikov::Graph::isDouble(size_t key1, size_t key2)
+bool kovshikov::Graph::isDouble(size_t key1, size_t key2) const
 {
   bool have1 = tree.at(key1).edges.find(key2) != tree.at(key1).edges.end();
   bool have2 = tree.at(key2).edges.find(key1) != tree.at(key2).edges.end();
@@ -65,34 +64,111 @@ bool kovshikov::noThis(size_t whoKey, size_t randomKey)
   return whoKey != randomKey;
 }
 
-void kovshikov::Graph::getConnectKeys(DoubleList< size_t >& connectKeys, size_t whoKey)
+kovshikov::Graph::VertexRange kovshikov::Graph::getVertexes() const
 {
-   DoubleList< size_t > keys;
-   std::transform(tree.begin(), tree.end(), std::back_inserter(keys), getKey);
-   std::copy_if(keys.begin(), keys.end(), std::back_inserter(connectKeys), std::bind(noThis, whoKey, std::placeholders::_1));
+  return std::make_pair(tree.cbegin(), tree.cend());
 }
 
-std::string kovshikov::Graph::getVertex(std::pair< size_t, Node > vertex)
+kovshikov::Graph::EdgeRange kovshikov::Graph::getNeighbours(size_t key) const
+{
+  auto vertex = tree.find(key);
+  if(vertex == tree.end())
+  {
+    throw std::logic_error("This key does not exist");
+  }
+  const Tree< size_t, size_t >& edges = vertex -> second.edges;
+  return std::make_pair(edges.cbegin(), edges.cend());
+}
+
+size_t kovshikov::Graph::getOutDegree(size_t key) const
+{
+  EdgeRange neighbours = getNeighbours(key);
+  return std::distance(neighbours.first, neighbours.second);
+}
+
+size_t kovshikov::Graph::getInDegree(size_t key) const
+{
+  haveThisVertex(key);
+  size_t degree = 0;
+  for(VertexIterator current = tree.cbegin(); current != tree.cend(); ++current)
+  {
+    if(noThis(key, current -> first) && current -> second.edges.find(key) != current -> second.edges.end())
+    {
+      degree += 1;
+    }
+  }
+  return degree;
+}
+
+void kovshikov::Graph::getByDegree(DegreeView& view) const
+{
+  Tree< size_t, size_t > inDegrees;
+  for(VertexIterator vertex = tree.cbegin(); vertex != tree.cend(); ++vertex)
+  {
+    const Tree< size_t, size_t >& edges = vertex -> second.edges;
+    for(EdgeIterator edge = edges.cbegin(); edge != edges.cend(); ++edge)
+    {
+      if(noThis(vertex -> first, edge -> first))
+      {
+        inDegrees[edge -> first] += 1;
+      }
+    }
+  }
+
+  Tree< size_t, DoubleList< const Vertex* >, std::greater< size_t > > buckets;
+  for(VertexIterator vertex = tree.cbegin(); vertex != tree.cend(); ++vertex)
+  {
+    auto in = inDegrees.find(vertex -> first);
+    size_t degree = getCountEdge(*vertex) + ((in == inDegrees.end()) ? 0 : in -> second);
+    buckets[degree].push_back(std::addressof(*vertex));
+  }
+  for(auto bucket = buckets.cbegin(); bucket != buckets.cend(); ++bucket)
+  {
+    for(auto vertex = bucket -> second.begin(); vertex != bucket -> second.end(); ++vertex)
+    {
+      view.push_back(std::make_pair(bucket -> first, *vertex));
+    }
+  }
+}
+
+void kovshikov::Graph::getByWeight(WeightView& view, size_t key) const
+{
+  EdgeRange neighbours = getNeighbours(key);
+  Tree< size_t, WeightView, std::greater< size_t > > buckets;
+  for(EdgeIterator edge = neighbours.first; edge != neighbours.second; ++edge)
+  {
+    buckets[getWeightEdge(*edge)].push_back(std::addressof(*edge));
+  }
+  for(auto bucket = buckets.cbegin(); bucket != buckets.cend(); ++bucket)
+  {
+    for(auto edge = bucket -> second.begin(); edge != bucket -> second.end(); ++edge)
+    {
+      view.push_back(*edge);
+    }
+  }
+}
+
+const std::string& kovshikov::Graph::getVertex(const Vertex& vertex)
 {
   return vertex.second.value;
 }
 
-size_t kovshikov::Graph::getCountEdge(std::pair< size_t, Node > vertex)
+size_t kovshikov::Graph::getCountEdge(const Vertex& vertex)
 {
   return vertex.second.edges.size();
 }
 
-size_t kovshikov::getKey(std::pair< size_t, Graph::Node > vertex)
+size_t kovshikov::getKey(const Graph::Vertex& vertex)
 {
   return vertex.first;
 }
 
-size_t kovshikov::getWith(std::pair< size_t, size_t > edge)
+size_t kovshikov::getWith(const Graph::Edge& edge)
 {
   return edge.first;
 }
 
-size_t kovshikov::getWeightEdge(std::pair< size_t, size_t > edge)
+size_t kovshikov::getWeightEdge(const Graph::Edge& edge)
 {
   return edge.second;
 }
@@ -112,18 +188,12 @@ void kovshikov::Graph::deleteVertex(size_t key)
   {
     throw;
   }
-  DoubleList< size_t > allKeys;
-  std::transform(tree.begin(), tree.end(), std::back_inserter(allKeys), getKey);
-  DoubleList< size_t > keys;
-  auto current = keys.begin();
-  std::copy_if(allKeys.begin(), allKeys.end(), std::back_inserter(keys), std::bind(noThis, key, std::placeholders::_1));
-  while(current != keys.end())
+  for(auto current = tree.begin(); current != tree.end(); ++current)
   {
-    if(tree[*current].edges.find(key) != tree[*current].edges.end())
+    if(noThis(key, current -> first))
     {
-      tree[*current].edges.erase(key);
+      current -> second.edges.erase(key);
     }
-    current++;
   }
   tree.erase(key);
 }
@@ -232,35 +302,33 @@ void kovshikov::Graph::change(size_t count, size_t who, size_t with)
 void kovshikov::Graph::connect(size_t whoKey, size_t count, size_t weight)
 {
   size_t size = getSize() - 1;
+  if(size == 0)
+  {
+    throw std::logic_error("There are no vertices to connect with");
+  }
+  size_t numCircules = count / size;
   size_t remainder = count % size;
-  size_t numCircules = (remainder == 0)?(count / size):(count / size + 1);
-  DoubleList< size_t > connectKeys;
-  getConnectKeys(connectKeys, whoKey);
-  for(size_t i = 1; i <= numCircules; i++)
+  VertexRange vertexes = getVertexes();
+  for(VertexIterator current = vertexes.first; current != vertexes.second; ++current)
   {
-    if(i == numCircules)
+    if(!noThis(whoKey, current -> first))
     {
-      auto current = connectKeys.begin();
-      current++;
-      for(size_t j = 1; j <= remainder; j++)
-      {
-        increaseWeight(whoKey, *current, weight);
-        current++;
-      }
+      continue;
     }
-    else
+    size_t links = numCircules;
+    if(remainder != 0)
     {
-      auto current = connectKeys.begin();
-      for(size_t k = 0; k < size; k++)
-      {
-        increaseWeight(whoKey, *current, weight);
-        current++;
-      }
+      links += 1;
+      remainder -= 1;
+    }
+    if(links != 0)
+    {
+      increaseWeight(whoKey, current -> first, weight * links);
     }
   }
 }
 
-size_t kovshikov::Graph::getVertexWeight(size_t key)
+size_t kovshikov::Graph::getVertexWeight(size_t key) const
 {
   try
   {
@@ -270,71 +338,46 @@ size_t kovshikov::Graph::getVertexWeight(size_t key)
   {
     throw;
   }
-  DoubleList< size_t > sum;
-  std::transform(tree.at(key).edges.begin(), tree.at(key).edges.end(), std::back_inserter(sum), getWeightEdge);
-  return std::accumulate(sum.begin(), sum.end(), 0);
+  EdgeRange neighbours = getNeighbours(key);
+  size_t sum = 0;
+  for(EdgeIterator edge = neighbours.first; edge != neighbours.second; ++edge)
+  {
+    sum += getWeightEdge(*edge);
+  }
+  return sum;
 }
 
-size_t kovshikov::Graph::getDegree(size_t key)
+size_t kovshikov::Graph::getDegree(size_t key) const
 {
-  try
-  {
-    haveThisVertex(key);
-  }
-  catch(const std::logic_error& e)
-  {
-    throw;
-  }
-  size_t degree = 0;
-  degree += tree.at(key).edges.size();
-  DoubleList< size_t > allKeys;
-  std::transform(tree.begin(), tree.end(), std::back_inserter(allKeys), getKey);
-  DoubleList< size_t > keys;
-  std::copy_if(allKeys.begin(), allKeys.end(), std::back_inserter(keys), std::bind(noThis, key, std::placeholders::_1));
-  auto current = keys.begin();
-  while(current != keys.end())
-  {
-    if(tree[*current].edges.find(key) != tree[*current].edges.end())
-    {
-      degree += 1;
-    }
-    current++;
-  }
-  return degree;
+  return getOutDegree(key) + getInDegree(key);
 }
 
-size_t kovshikov::Graph::getOwn(size_t key)
+size_t kovshikov::Graph::getOwn(size_t key) const
 {
-  try
-  {
-    haveThisVertex(key);
-  }
-  catch(const std::logic_error& e)
-  {
-    throw;
-  }
+  haveThisVertex(key);
   size_t own = 0;
-  DoubleList< size_t > allKeys;
-  std::transform(tree.begin(), tree.end(), std::back_inserter(allKeys), getKey);
-  DoubleList< size_t > keys;
-  std::copy_if(allKeys.begin(), allKeys.end(), std::back_inserter(keys), std::bind(noThis, key, std::placeholders::_1));
-  auto current = keys.begin();
-  while(current != keys.end())
-  {
-    if(tree[*current].edges.find(key) != tree[*current].edges.end())
+  for(VertexIterator current = tree.cbegin(); current != tree.cend(); ++current)
+  {
+    if(noThis(key, current -> first))
     {
-      own += tree[*current].edges[key];
+      auto edge = current -> second.edges.find(key);
+      if(edge != current -> second.edges.end())
+      {
+        own += getWeightEdge(*edge);
+      }
     }
-    current++;
   }
   return own;
 }
 
-size_t kovshikov::Graph::getEdges()
+size_t kovshikov::Graph::getEdges() const
 {
-  DoubleList< size_t > count;
-  std::transform(tree.begin(), tree.end(), std::back_inserter(count), getCountEdge);
-  return std::accumulate(count.begin(), count.end(), 0);
+  size_t count = 0;
+  for(VertexIterator current = tree.cbegin(); current != tree.cend(); ++current)
+  {
+    count += getCountEdge(*current);
+  }
+  return count;
 }
 
 void kovshikov::Graph::outGraph(std::ostream& out) const
@@ -346,36 +389,22 @@ void kovshikov::Graph::outGraph(std::ostream& out) const
   }
   else
   {
-    DoubleList< size_t > keysList;
-    std::transform(tree.begin(), tree.end(), std::back_inserter(keysList), getKey);
-    auto curKeysList = keysList.begin();
-    while(curKeysList != keysList.end())
+    for(VertexIterator vertex = tree.cbegin(); vertex != tree.cend(); ++vertex)
     {
-      out << *curKeysList << " " << tree.at(*curKeysList).value << " ";
-      if(tree.at(*curKeysList).edges.empty())
+      out << getKey(*vertex) << " " << getVertex(*vertex) << " ";
+      const Tree< size_t, size_t >& edges = vertex -> second.edges;
+      if(edges.empty())
       {
         out << 0 << "\n";
+        continue;
       }
-      else
+      EdgeIterator edge = edges.cbegin();
+      while(edge != edges.cend())
       {
-        DoubleList< size_t > keysWith;
-        std::transform(tree.at(*curKeysList).edges.begin(), tree.at(*curKeysList).edges.end(), std::back_inserter(keysWith), getWith);
-        auto curKeysWith = keysWith.begin();
-        size_t count = tree.at(*curKeysList).edges.size();
-        for(size_t j = 0; j < count; j++)
-        {
-          if(j == count - 1)
-          {
-            out << *curKeysWith << " : " << tree.at(*curKeysList).edges.at(*curKeysWith) << "\n";
-          }
-          else
-          {
-            out << *curKeysWith << " : " << tree.at(*curKeysList).edges.at(*curKeysWith) << "  ";
-          }
-          curKeysWith++;
-        }
+        out << getWith(*edge) << " : " << getWeightEdge(*edge);
+        ++edge;
+        out << ((edge == edges.cend()) ? "\n" : "  ");
       }
-      curKeysList++;
     }
   }
 }
@@ -391,29 +420,21 @@ size_t kovshikov::Graph::getSize() const noexcept
   return tree.size();
 }
 
-bool kovshikov::Graph::comp(std::pair< size_t, Node > left, std::pair< size_t, Node > right, Graph& graph)
-{
-  return graph.getDegree(left.first) > graph.getDegree(right.first);
-}
-void kovshikov::Graph::getMax(std::ostream& out)
+void kovshikov::Graph::getMax(std::ostream& out) const
 {
-  using namespace std::placeholders;
-  DoubleList< std::pair< size_t, Node > > tempVector;
-  std::copy(tree.begin(), tree.end(), std::back_inserter(tempVector));
-  selectionSort(tempVector.begin(), tempVector.end(), std::bind(comp, _1, _2, *this));
-  size_t max = tempVector.front().first;
-  DoubleList< size_t > keys;
-  std::transform(tree.begin(), tree.end(), std::back_inserter(keys), getKey);
-  DoubleList< size_t > keysWithout;
-  std::copy_if(keys.begin(), keys.end(), std::back_inserter(keysWithout), std::bind(noThis, max, _1));
-  auto iterator = keysWithout.begin();
-  while(iterator != keysWithout.end())
+  auto outEmpty = std::bind(outMessage, "This graph is empty", std::placeholders::_1);
+  if(isEmpty())
   {
-    if(getDegree(max) == getDegree(*iterator))
-    {
-      out << *iterator << " ";
-    }
-    iterator++;
+    outEmpty(out);
+    return;
+  }
+  DegreeView view;
+  getByDegree(view);
+  auto max = view.begin();
+  auto current = max;
+  for(++current; current != view.end() && current -> first == max -> first; ++current)
+  {
+    out << getKey(*current -> second) << " ";
   }
-  out << max << "\n";
+  out << getKey(*max -> second) << "\n";
 }
@@ -18,6 +18,15 @@ namespace kovshikov
 
     class Node;
 
+    using Vertex = std::pair< size_t, Node >;
+    using Edge = std::pair< size_t, size_t >;
+    using VertexIterator = Tree< size_t, Node >::ConstIterator;
+    using EdgeIterator = Tree< size_t, size_t >::ConstIterator;
+    using VertexRange = std::pair< VertexIterator, VertexIterator >;
+    using EdgeRange = std::pair< EdgeIterator, EdgeIterator >;
+    using DegreeView = DoubleList< std::pair< size_t, const Vertex* > >;
+    using WeightView = DoubleList< const Edge* >;
+
     void addVertex(size_t key, std::string str);
     void deleteVertex(size_t key);
 
@@ -30,37 +39,41 @@ namespace kovshikov
 
     void connect(size_t whoKey, size_t count, size_t weight);
 
-    size_t getVertexWeight(size_t key);
-    size_t getDegree(size_t key);
-    size_t getOwn(size_t key);
-    size_t getEdges();
+    size_t getVertexWeight(size_t key) const;
+    size_t getDegree(size_t key) const;
+    size_t getOwn(size_t key) const;
+    size_t getEdges() const;
+
+    void haveThisVertex(size_t key) const;
+    void haveNot(size_t keyWho, size_t keyWith) const;
+    bool haveThisKey(size_t key) const;
+    bool isDouble(size_t key1, size_t key2) const;
 
-    void haveThisVertex(size_t key);
-    void haveNot(size_t keyWho, size_t keyWith);
-    bool haveThisKey(size_t key);
-    bool isDouble(size_t key1, size_t key2);
+    VertexRange getVertexes() const;
+    EdgeRange getNeighbours(size_t key) const;
+    size_t getOutDegree(size_t key) const;
+    size_t getInDegree(size_t key) const;
+    void getByDegree(DegreeView& view) const;
+    void getByWeight(WeightView& view, size_t key) const;
 
-    void getConnectKeys(DoubleList< size_t >& connectKeys, size_t whoKey);
-    std::string getVertex(std::pair< size_t, Node > vertex);
-    static size_t getCountEdge(std::pair< size_t, Node > vertex);
+    static const std::string& getVertex(const Vertex& vertex);
+    static size_t getCountEdge(const Vertex& vertex);
 
     void outGraph(std::ostream& out) const;
 
-    void getMax(std::ostream& out);
+    void getMax(std::ostream& out) const;
     bool isEmpty() const noexcept;
     size_t getSize() const noexcept;
 
-    static bool comp(std::pair< size_t, Node > left, std::pair< size_t, Node > right, Graph& graph);
-
   private:
     Tree< size_t, Node > tree;
   };
 
   bool noThis(size_t whoKey, size_t randomKey);
 
-  size_t getKey(std::pair< size_t, Graph::Node > vertex);
-  size_t getWith(std::pair< size_t, size_t > edge);
-  size_t getWeightEdge(std::pair< size_t, size_t > edge);
+  size_t getKey(const Graph::Vertex& vertex);
+  size_t getWith(const Graph::Edge& edge);
+  size_t getWeightEdge(const Graph::Edge& edge);
 }
 
 class kovshikov::Graph::Node
@@ -37,7 +37,7 @@ void kovshikov::add(Graph& graph, std::istream& is)
   }
 }
 
-std::string kovshikov::getGraphname(std::pair< std::string, Graph > element)
+const std::string& kovshikov::getGraphname(const std::pair< std::string, Graph >& element)
 {
   return element.first;
 }
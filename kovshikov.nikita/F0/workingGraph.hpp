@@ -6,7 +6,7 @@
 namespace kovshikov
 {
   bool isDigit(char ch);
-  std::string getGraphname(std::pair< std::string, Graph > element);
+  const std::string& getGraphname(const std::pair< std::string, Graph >& element);
 
   void add(Graph& graph, std::istream& is);
   void connect(Graph& graph, std::istream& is);
@@ -1,48 +1,48 @@
-#include <cstring>
+#include <cctype>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
 #include "computing.hpp"
 
-void kovshikov::readData(std::istream& in, Queue< std::string >& allData)
+bool kovshikov::readToken(const std::string& str, size_t& pos, Token& token)
 {
-  while(!in.eof())
+  size_t size = str.length();
+  while(pos < size && std::isspace(str[pos]))
   {
-    std::string expression = "";
-    std::getline(in, expression);
-    if(!expression.empty())
-    {
-      allData.push(expression);
-    }
+    pos++;
   }
-}
-
-void kovshikov::separateElements(std::string str, Queue< std::string >& queue)
-{
-  std::string temp = "";
-  size_t sizeStr = str.length();
-  for(size_t i = 0; i < sizeStr; i++)
+  if(pos == size)
   {
-    if(str[i] != ' ')
-    {
-      temp += str[i];
-    }
-    else
+    return false;
+  }
+  if(std::isdigit(str[pos]))
+  {
+    long long max = std::numeric_limits< long long >::max();
+    token.symbol = 0;
+    token.value = 0;
+    while(pos < size && std::isdigit(str[pos]))
     {
-      queue.push(temp);
-      temp = "";
+      long long digit = str[pos] - '0';
+      if(token.value > (max - digit) / 10)
+      {
+        throw std::out_of_range("You've gone out of range long long");
+      }
+      token.value = token.value * 10 + digit;
+      pos++;
     }
   }
-  queue.push(temp);
-}
-
-void kovshikov::separateElements(Queue< std::string > oldQ, doubleQ& sepQ)
-{
-  size_t size = oldQ.getSize();
-  for(size_t i = 0; i < size; i++)
+  else
   {
-    Queue< std::string > queue;
-    separateElements(oldQ.front(), queue);
-    oldQ.pop();
-    sepQ.push(queue);
+    token.symbol = str[pos];
+    token.value = 0;
+    pos++;
+    if(token.symbol != '(' && token.symbol != ')' && getPriority(token.symbol) == 0)
+    {
+      throw std::invalid_argument("Unknown symbol in expression");
+    }
   }
+  return true;
 }
 
 int kovshikov::getPriority(char c)
@@ -61,192 +61,182 @@ int kovshikov::getPriority(char c)
   }
 }
 
-bool kovshikov::isDigit(std::string str)
+void kovshikov::getPostfix(const std::string& expression, Queue< Token >& postfix)
 {
-  size_t size = str.length();
-  for(size_t i = 0; i < size; i++)
+  Stack< char > stack;
+  size_t pos = 0;
+  Token token;
+  while(readToken(expression, pos, token))
   {
-    if(!std::isdigit(str[i]))
+    if(token.symbol == 0)
     {
-      return false;
+      postfix.push(token);
     }
-  }
-  return true;
-}
-
-void kovshikov::getPostfix(Queue< std::string >& oldQ, Queue< std::string >& newQ)
-{
-  bool isCorrect = true;
-  Stack< std::string > stack;
-  std::string element = "";
-  size_t size = oldQ.getSize();
-  for(size_t i = 0; i < size; i++)
-  {
-    element = oldQ.front();
-    oldQ.pop();
-    if(isDigit(element))
+    else if(token.symbol == '(')
     {
-      newQ.push(element);
+      stack.push(token.symbol);
     }
-    else if(element[0] == '(')
+    else if(token.symbol == ')')
     {
-      isCorrect = false;
-      stack.push(element);
-    }
-    else if(element[0] == ')')
-    {
-      isCorrect = true;
-      while(stack.top()[0] != '(')
+      while(!stack.isEmpty() && stack.top() != '(')
       {
-        newQ.push(stack.top());
+        postfix.push(Token{ stack.top(), 0 });
         stack.pop();
       }
+      if(stack.isEmpty())
+      {
+        throw std::domain_error("A single closing bracket");
+      }
       stack.pop();
     }
     else
     {
-      while(!stack.isEmpty() && getPriority(element[0]) <= getPriority(stack.top()[0]))
+      while(!stack.isEmpty() && getPriority(token.symbol) <= getPriority(stack.top()))
       {
-        newQ.push(stack.top());
+        postfix.push(Token{ stack.top(), 0 });
         stack.pop();
       }
-      stack.push(element);
+      stack.push(token.symbol);
     }
   }
   while(!stack.isEmpty())
   {
-    newQ.push(stack.top());
+    if(stack.top() == '(')
+    {
+      throw std::domain_error("A single opening bracket");
+    }
+    postfix.push(Token{ stack.top(), 0 });
     stack.pop();
   }
-  if(isCorrect == false)
-  {
-    throw std::domain_error("A single opening bracket");
-  }
 }
 
-void kovshikov::getPostfix(doubleQ oldQ, doubleQ& newQ)
+long long kovshikov::calculate(long long operand, long long upperOperand, char operation)
 {
-  size_t size = oldQ.getSize();
-  for(size_t i = 0; i < size; i++)
+  long long min = std::numeric_limits< long long >::min();
+  long long max = std::numeric_limits< long long >::max();
+  if(operation == '+')
+  {
+    if((upperOperand > 0 && operand > max - upperOperand) || (upperOperand < 0 && operand < min - upperOperand))
+    {
+      throw std::overflow_error("overflow after summa");
+    }
+    return operand + upperOperand;
+  }
+  else if(operation == '-')
+  {
+    if((upperOperand < 0 && operand > max + upperOperand) || (upperOperand > 0 && operand < min + upperOperand))
+    {
+      throw std::overflow_error("overflow after subtraction");
+    }
+    return operand - upperOperand;
+  }
+  else if(operation == '*')
   {
-    Queue< std::string > queue;
-    try
+    bool isOverflow = false;
+    if(operand > 0)
+    {
+      isOverflow = (upperOperand > 0) ? operand > max / upperOperand : upperOperand < min / operand;
+    }
+    else if(operand < 0)
     {
-      getPostfix(oldQ.front(), queue);
+      isOverflow = (upperOperand > 0) ? operand < min / upperOperand : upperOperand < max / operand;
     }
-    catch(const std::exception &error)
+    if(isOverflow)
     {
-      throw;
+      throw std::range_error("range violation during multiplication");
     }
-    oldQ.pop();
-    newQ.push(queue);
+    return operand * upperOperand;
+  }
+  if(upperOperand == 0)
+  {
+    throw std::domain_error("division by zero");
+  }
+  if(operation == '/')
+  {
+    if(operand == min && upperOperand == -1)
+    {
+      throw std::overflow_error("overflow after division");
+    }
+    return operand / upperOperand;
+  }
+  if(upperOperand == -1)
+  {
+    return 0;
+  }
+  long long remainder = operand % upperOperand;
+  if(operand > 0 || remainder == 0)
+  {
+    return remainder;
   }
+  return calculate(remainder, upperOperand, '+');
 }
 
-long long kovshikov::getComputation(Queue< std::string > queue)
+long long kovshikov::getComputation(Queue< Token >& postfix)
 {
-  long long min = std::numeric_limits< long long >::min();
-  long long max = std::numeric_limits< long long >::max();
   Stack< long long > stack;
-  size_t size = queue.getSize();
-  for(size_t i = 0; i < size; i++)
+  while(!postfix.isEmpty())
   {
-    std::string element = queue.front();
-    queue.pop();
-    if(isDigit(element))
+    Token token = postfix.front();
+    postfix.pop();
+    if(token.symbol == 0)
     {
-      long long integer = std::stoll(element);
-      if(integer == min)
-      {
-        throw std::underflow_error("You've gone out of range long long от -9223372036854775808");
-      }
-      stack.push(integer);
+      stack.push(token.value);
+      continue;
     }
-    else
+    if(stack.isEmpty())
     {
-      long long upperOperand = stack.top();
-      stack.pop();
-      long long operand = stack.top();
-      stack.pop();
-      if(element == "+")
-      {
-        long long summa = operand + upperOperand;
-        if(operand > 0 && upperOperand > 0 && summa < 0 )
-        {
-          throw std::overflow_error("overflow after summa");
-        }
-        stack.push(summa);
-      }
-      else if(element == "-")
-      {
-        stack.push(operand - upperOperand);
-      }
-      else if(element == "*")
-      {
-        bool condOperand = operand > max / std::abs(upperOperand) || operand < min / std::abs(upperOperand);
-        bool condUOperand = upperOperand > max / std::abs(operand) || upperOperand < min / std::abs(operand);
-        if(condOperand || condUOperand)
-        {
-          throw std::range_error("range violation during multiplication");
-        }
-        stack.push(operand * upperOperand);
-      }
-      else if(element == "/")
-      {
-        stack.push(operand / upperOperand);
-      }
-      else if(element == "%")
-      {
-        if(operand > 0)
-        {
-          stack.push(operand % upperOperand);
-        }
-        else
-        {
-          long long part = std::abs(operand / upperOperand);
-          part++;
-          long long temp = part * upperOperand;
-          stack.push(operand + temp);
-        }
-      }
+      throw std::invalid_argument("Not enough operands");
     }
+    long long upperOperand = stack.top();
+    stack.pop();
+    if(stack.isEmpty())
+    {
+      throw std::invalid_argument("Not enough operands");
+    }
+    long long operand = stack.top();
+    stack.pop();
+    stack.push(calculate(operand, upperOperand, token.symbol));
+  }
+  if(stack.isEmpty())
+  {
+    throw std::invalid_argument("Empty expression");
   }
-  return stack.top();
+  long long result = stack.top();
+  stack.pop();
+  if(!stack.isEmpty())
+  {
+    throw std::invalid_argument("Not enough operators");
+  }
+  return result;
 }
 
-void kovshikov::getComputation(doubleQ data, Stack< long long >& result)
+void kovshikov::evaluateStream(std::istream& in, Stack< long long >& result)
 {
-  long long outcome;
-  size_t size = data.getSize();
-  for(size_t i = 0; i < size; i++)
+  std::string expression = "";
+  Queue< Token > postfix;
+  while(std::getline(in, expression))
   {
-    Queue< std::string > temp = data.front();
-    data.pop();
-    try
+    if(expression.find_first_not_of(" \t\r") == std::string::npos)
     {
-      outcome = getComputation(temp);
+      continue;
     }
-    catch(const std::exception &error)
-    {
-      throw;
-    }
-    result.push(outcome);
+    getPostfix(expression, postfix);
+    result.push(getComputation(postfix));
   }
 }
 
-void kovshikov::output(std::ostream& out, Stack< long long > result)
+void kovshikov::output(std::ostream& out, Stack< long long >& result)
 {
-  size_t size = result.getSize();
-  for(size_t i = 0; i < size; i++)
+  bool isFirst = true;
+  while(!result.isEmpty())
   {
-    if(i == size - 1)
+    if(!isFirst)
     {
-      out << result.top();
-      result.pop();
+      out << " ";
     }
-    else
-    out << result.top() << " ";
+    out << result.top();
     result.pop();
+    isFirst = false;
   }
   out << "\n";
 }
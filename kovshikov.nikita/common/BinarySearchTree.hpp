@@ -741,104 +741,94 @@ template< typename Key, typename Value, typename Compare >
 typename kovshikov::Tree< Key, Value, Compare >::Iterator kovshikov::Tree< Key, Value, Compare >::erase(Iterator iterator)
 {
   Node* toDelete = iterator.node_;
-  Node* bigFather = toDelete -> father_;
-  Node* changer = nullptr;
-  Node* temp = nullptr;
-  Node* toBalance = nullptr;
   if(toDelete == nullptr)
   {
     return end();
   }
-  if(toDelete -> left_ == nullptr && toDelete -> right_ == nullptr)
-  {
-    if(bigFather != nullptr)
-    {
-      if(comp(toDelete -> element_.first, bigFather -> element_.first))
-      {
-        bigFather -> left_ = nullptr;
-      }
-      else
-      {
-        bigFather -> right_ = nullptr;
-      }
-      delete toDelete;
-      balance(bigFather);
-      return Iterator(bigFather, root_);
-    }
-    else
-    {
-      delete toDelete;
-      return end();
-    }
-  }
-  else if(toDelete -> left_ == nullptr && toDelete -> right_ != nullptr)
+  Iterator next = iterator;
+  ++next;
+  Node* bigFather = toDelete -> father_;
+  Node* changer = nullptr;
+  Node* toBalance = bigFather;
+  if(toDelete -> left_ == nullptr && toDelete -> right_ != nullptr)
   {
     changer = toDelete -> right_;
-    temp = changer -> left_;
-    while(temp != nullptr)
+    while(changer -> left_ != nullptr)
     {
-      changer = temp;
-      temp = temp -> left_;
-    }
-    toBalance = changer -> father_;
-    if(toBalance != toDelete)
-    {
-      toBalance -> left_ = nullptr;
+      changer = changer -> left_;
     }
   }
-  else
+  else if(toDelete -> left_ != nullptr)
   {
     changer = toDelete -> left_;
-    temp = changer -> right_;
-    while(temp != nullptr)
+    while(changer -> right_ != nullptr)
     {
-      changer = temp;
-      temp = temp -> right_;
+      changer = changer -> right_;
     }
+  }
+
+  if(changer != nullptr)
+  {
     toBalance = changer -> father_;
     if(toBalance != toDelete)
     {
-      toBalance -> right_ = nullptr;
+      Node* child = (changer -> left_ != nullptr) ? changer -> left_ : changer -> right_;
+      if(toBalance -> left_ == changer)
+      {
+        toBalance -> left_ = child;
+      }
+      else
+      {
+        toBalance -> right_ = child;
+      }
+      if(child != nullptr)
+      {
+        child -> father_ = toBalance;
+      }
+      changer -> left_ = toDelete -> left_;
+      changer -> right_ = toDelete -> right_;
     }
-  }
-  if(bigFather != nullptr)
-  {
-    if(comp(toDelete -> element_.first, bigFather -> element_.first))
+    else
+    {
+      toBalance = changer;
+      if(toDelete -> left_ == changer)
+      {
+        changer -> right_ = toDelete -> right_;
+      }
+      else
+      {
+        changer -> left_ = toDelete -> left_;
+      }
+    }
+    if(changer -> left_ != nullptr)
     {
-      bigFather -> left_ = changer;
+      changer -> left_ -> father_ = changer;
     }
-    else
+    if(changer -> right_ != nullptr)
     {
-      bigFather -> right_ = changer;
+      changer -> right_ -> father_ = changer;
     }
+    changer -> father_ = bigFather;
   }
-  changer -> father_ = bigFather;
-  if(toDelete -> left_ != nullptr && changer != toDelete -> left_)
-  {
-    changer -> left_ = toDelete -> left_;
-    toDelete -> left_ -> father_ = changer;
-  }
-  if(toDelete -> right_ != nullptr && changer != toDelete -> right_)
+
+  if(bigFather == nullptr)
   {
-    changer -> right_ = toDelete -> right_;
-    toDelete -> right_ -> father_ = changer;
+    root_ = changer;
   }
-
-  if(toBalance != toDelete)
+  else if(bigFather -> left_ == toDelete)
   {
-    delete toDelete;
-    balance(toBalance);
+    bigFather -> left_ = changer;
   }
   else
   {
-    delete toDelete;
-    balance(changer);
+    bigFather -> right_ = changer;
   }
-  if(bigFather == nullptr)
+  delete toDelete;
+  if(toBalance != nullptr)
   {
-    root_ = changer;
+    balance(toBalance);
   }
-  return Iterator(changer, root_);
+  return Iterator(next.node_, root_);
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -1,12 +1,65 @@
 #include "InpOutpProcessing.hpp"
+#include <algorithm>
+#include <iostream>
 #include <limits>
 
-size_t mihalchenko::printName(mainList &mixedList, size_t mixedListSize, size_t maxLenOfSecondList)
+size_t mihalchenko::RaggedArray::getRowCount() const
 {
-  for (size_t i = 0; i < mixedListSize; i++)
+  return offsets.size();
+}
+
+size_t mihalchenko::RaggedArray::getRowSize(size_t row) const
+{
+  size_t end = (row + 1 < offsets.size()) ? offsets[row + 1] : values.size();
+  return end - offsets[row];
+}
+
+void mihalchenko::RaggedArray::addRow()
+{
+  offsets.push_back(values.size());
+}
+
+mihalchenko::RaggedArray mihalchenko::transpose(const RaggedArray &rows, size_t columnCount)
+{
+  std::vector< size_t > columnSizes(columnCount, 0);
+  for (size_t i = 0; i < rows.getRowCount(); i++)
+  {
+    size_t rowSize = std::min(rows.getRowSize(i), columnCount);
+    for (size_t j = 0; j < rowSize; j++)
+    {
+      columnSizes[j]++;
+    }
+  }
+
+  RaggedArray columns;
+  columns.offsets.reserve(columnCount);
+  size_t total = 0;
+  for (size_t j = 0; j < columnCount; j++)
+  {
+    columns.offsets.push_back(total);
+    total += columnSizes[j];
+  }
+  columns.values.resize(total);
+
+  std::vector< size_t > cursors(columns.offsets);
+  for (size_t i = 0; i < rows.getRowCount(); i++)
   {
-    std::cout << mixedList[i].first;
-    if (i != mixedListSize - 1)
+    const size_t *row = rows.values.data() + rows.offsets[i];
+    size_t rowSize = std::min(rows.getRowSize(i), columnCount);
+    for (size_t j = 0; j < rowSize; j++)
+    {
+      columns.values[cursors[j]++] = row[j];
+    }
+  }
+  return columns;
+}
+
+size_t mihalchenko::printName(const RaggedArray &rows, size_t maxLenOfSecondList)
+{
+  for (size_t i = 0; i < rows.names.size(); i++)
+  {
+    std::cout << rows.names[i];
+    if (i != rows.names.size() - 1)
     {
       std::cout << " ";
     }
@@ -22,12 +75,12 @@ size_t mihalchenko::printName(mainList &mixedList, size_t mixedListSize, size_t
   return 0;
 }
 
-size_t mihalchenko::printSumDigit(integerList &tempIntList, size_t tempIntListSize)
+size_t mihalchenko::printSumDigit(const std::vector< size_t > &sums)
 {
-  for (size_t i = 0; i < tempIntListSize; i++)
+  for (size_t i = 0; i < sums.size(); i++)
   {
-    std::cout << tempIntList[i];
-    if (i != tempIntListSize - 1)
+    std::cout << sums[i];
+    if (i != sums.size() - 1)
     {
       std::cout << " ";
     }
@@ -36,37 +89,43 @@ size_t mihalchenko::printSumDigit(integerList &tempIntList, size_t tempIntListSi
   return 0;
 }
 
-size_t mihalchenko::printMixedList(mainList &mixedList, size_t mixedListSize, size_t numericView, bool &flgNewStr)
+size_t mihalchenko::printMixedList(const RaggedArray &columns, size_t numericView)
 {
+  const size_t *column = columns.values.data() + columns.offsets[numericView];
+  size_t columnSize = columns.getRowSize(numericView);
   size_t summa = 0;
-  flgNewStr = true;
-  summa = 0;
-  size_t ullMax = std::numeric_limits< size_t >::max();
-  for (size_t i = 0; i < mixedListSize; i++)
+  bool overflow = false;
+  for (size_t i = 0; i < columnSize; i++)
   {
-    if (mixedList[i].second.getSize() > numericView)
+    size_t next = summa + column[i];
+    overflow |= next < summa;
+    summa = next;
+  }
+
+  size_t printed = columnSize;
+  if (overflow)
+  {
+    summa = 0;
+    printed = 0;
+    while (summa + column[printed] >= summa)
+    {
+      summa += column[printed++];
+    }
+    printed++;
+  }
+  for (size_t i = 0; i < printed; i++)
+  {
+    if (i != 0)
     {
-      if (flgNewStr)
-      {
-        std::cout << mixedList[i].second[numericView];
-        flgNewStr = false;
-      }
-      else
-      {
-        std::cout << " " << mixedList[i].second[numericView];
-      }
-      if (ullMax - mixedList[i].second[numericView] >= summa)
-      {
-        summa = summa + mixedList[i].second[numericView];
-      }
-      else
-      {
-        std::cout << '\n';
-        std::cerr << "Input overflow!";
-        return ullMax;
-      }
+      std::cout << " ";
     }
+    std::cout << column[i];
   }
   std::cout << '\n';
+  if (overflow)
+  {
+    std::cerr << "Input overflow!";
+    return std::numeric_limits< size_t >::max();
+  }
   return summa;
 }
@@ -1,15 +1,26 @@
 #ifndef FUNCTIONS_HPP
 #define FUNCTIONS_HPP
 
-#include "list.hpp"
+#include <string>
+#include <vector>
 
 namespace mihalchenko
 {
-  using mainList = mihalchenko::List< std::pair< std::string, mihalchenko::List< size_t > > >;
-  using integerList = mihalchenko::List< size_t >;
-  size_t printName(mainList &mixedList, size_t mixedListSize, size_t maxLenOfSecondList);
-  size_t printSumDigit(integerList &tempIntList, size_t tempIntListSize);
-  size_t printMixedList(mainList &mixedList, size_t mixedListSize, size_t numericView, bool &flgNewStr);
+  struct RaggedArray
+  {
+    size_t getRowCount() const;
+    size_t getRowSize(size_t row) const;
+    void addRow();
+
+    std::vector< std::string > names;
+    std::vector< size_t > values;
+    std::vector< size_t > offsets;
+  };
+
+  RaggedArray transpose(const RaggedArray &rows, size_t columnCount);
+  size_t printName(const RaggedArray &rows, size_t maxLenOfSecondList);
+  size_t printSumDigit(const std::vector< size_t > &sums);
+  size_t printMixedList(const RaggedArray &columns, size_t numericView);
 }
 
 #endif
@@ -1,6 +1,7 @@
-#include <utility>
+#include <cctype>
+#include <cstdio>
+#include <iostream>
 #include <limits>
-#include "list.hpp"
 #include "InpOutpProcessing.hpp"
 
 int main()
@@ -9,28 +10,21 @@ int main()
 
   size_t maxLenOfSecondList = 0;
   size_t CountSecondList = 0;
-  size_t CountmixedList = 0;
-  using mainList = mihalchenko::List<std::pair<std::string, mihalchenko::List<size_t>>>;
-  using integerList = mihalchenko::List<size_t>;
-  mainList mixedList;
-  integerList tempIntList;
+  RaggedArray mixedList;
   std::string inputStr;
   bool flgNamed = false;
   while (std::cin >> inputStr)
   {
     if (!isdigit(inputStr[0]))
     {
-      std::string str;
-      str = inputStr;
       flgNamed = true;
-      tempIntList.clear();
       if (maxLenOfSecondList < CountSecondList)
       {
         maxLenOfSecondList = CountSecondList;
       }
       CountSecondList = 0;
-      mixedList.push_back(std::make_pair(str, tempIntList));
-      CountmixedList++;
+      mixedList.names.push_back(inputStr);
+      mixedList.addRow();
     }
     else
     {
@@ -43,7 +37,7 @@ int main()
         std::cout << 0 << '\n';
         return 0;
       }
-      mixedList[CountmixedList - 1].second.push_back(wrem);
+      mixedList.values.push_back(wrem);
       if (inputStr == std::to_string(wrem))
       {
         CountSecondList++;
@@ -55,19 +49,21 @@ int main()
       }
     }
   }
-  if (mixedList.getSize() == 0)
+  if (mixedList.getRowCount() == 0)
   {
     std::cout << 0 << '\n';
     return 0;
   }
 
-  mihalchenko::printName(mixedList, mixedList.getSize(), maxLenOfSecondList);
+  mihalchenko::printName(mixedList, maxLenOfSecondList);
 
-  bool flgNewStr = false;
+  RaggedArray columns = mihalchenko::transpose(mixedList, maxLenOfSecondList);
+  std::vector< size_t > sums;
+  sums.reserve(maxLenOfSecondList);
   size_t ullMax = std::numeric_limits<size_t>::max();
   for (size_t numericView = 0; numericView < maxLenOfSecondList; numericView++)
   {
-    size_t summa = mihalchenko::printMixedList(mixedList, mixedList.getSize(), numericView, flgNewStr);
+    size_t summa = mihalchenko::printMixedList(columns, numericView);
     if (summa == ullMax)
     {
       std::cerr << "Input overflow!";
@@ -75,9 +71,9 @@ int main()
     }
     else
     {
-      tempIntList.push_back(summa);
+      sums.push_back(summa);
     }
   }
-  mihalchenko::printSumDigit(tempIntList, tempIntList.getSize());
+  mihalchenko::printSumDigit(sums);
   return 0;
 }
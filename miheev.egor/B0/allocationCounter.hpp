@@ -0,0 +1,11 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+namespace miheev
+{
+  size_t getAllocations() noexcept;
+}
+
+#endif
@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "allocationCounter.hpp"
+#include "../S2/inputProcessing.hpp"
+
+int main(int argc, char* argv[])
+{
+  using namespace miheev;
+  size_t reps = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  if (argc > 2 || reps == 0)
+  {
+    std::cerr << "Usage: lab [repetitions]\n";
+    return 1;
+  }
+
+  const std::string expressions[] = {
+    "1 + 2",
+    "( 1 + 2 ) * 3 - 4 / 2",
+    "( ( 7 + 3 ) * ( 5 - 2 ) ) % 4 + 100 / ( 3 + 2 )"
+  };
+
+  std::cout << "calcLine, allocations per expression:\n";
+  for (const std::string& expression: expressions)
+  {
+    ExpressionArena arena;
+    size_t before = getAllocations();
+    long long checksum = calcLine(expression, arena);
+    size_t warmUp = getAllocations() - before;
+    before = getAllocations();
+    for (size_t i = 1; i < reps; ++i)
+    {
+      checksum += calcLine(expression, arena);
+    }
+    double perExpression = static_cast< double >(getAllocations() - before) / reps;
+    std::cout << "  " << expression << ": first call " << warmUp << ", then " << perExpression;
+    std::cout << " (checksum " << checksum << ")\n";
+  }
+
+  std::ostringstream input;
+  for (size_t i = 0; i < reps / 10; ++i)
+  {
+    input << expressions[i % 3] << '\n';
+  }
+  std::istringstream in(input.str());
+  size_t before = getAllocations();
+  auto start = std::chrono::steady_clock::now();
+  Stack< long long > results = processInput(in);
+  std::chrono::duration< double > time = std::chrono::steady_clock::now() - start;
+  std::cout << "processInput, " << reps / 10 << " lines: " << getAllocations() - before << " allocations, ";
+  std::cout << time.count() << " s\n";
+  return 0;
+}
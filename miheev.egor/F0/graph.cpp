@@ -13,6 +13,7 @@ void miheev::Graph::addNode(int name)
     throw std::invalid_argument("[ERROR](insertion): the node you want to add already exists");
   }
   nodes_.insert({name, Node{name}});
+  navigator_.invalidate();
 }
 
 void miheev::Graph::rmNode(int name)
@@ -25,6 +26,7 @@ void miheev::Graph::rmNode(int name)
     rmEdge(name, neighbourName);
   }
   nodes_.erase(name);
+  navigator_.invalidate();
 }
 
 void miheev::Graph::addEdge(int lnode, int rnode, size_t weight)
@@ -48,6 +50,7 @@ void miheev::Graph::addEdge(int lnode, int rnode, size_t weight)
 
   rightNode.edges.pushBack(fromRightToLeft);
   rightNode.backLinks.insert({lnode, fromLeftToRight});
+  navigator_.invalidate();
 }
 
 void miheev::Graph::rmEdge(int lnode, int rnode)
@@ -69,12 +72,17 @@ void miheev::Graph::rmEdge(int lnode, int rnode)
 
   rightNode.edges.remove(leftNode.backLinks[rnode]);
   leftNode.backLinks.erase(rnode);
+  navigator_.invalidate();
 }
 
 miheev::Graph::Path miheev::Graph::navigate(int start, int finish) const
 {
-  Dextra dextra(*this);
-  Path path = dextra(start, finish);
+  if (!navigator_.isActual())
+  {
+    navigator_.snapshot(nodes_);
+  }
+  Path path;
+  path.lenght = navigator_.route(start, finish, path.path);
   return path;
 }
 
@@ -157,107 +165,6 @@ bool miheev::Graph::Edge::operator==(const Edge& rhs) const
   return dest == rhs.dest && weight == rhs.weight;
 }
 
-miheev::Graph::Dextra::Dextra(const Graph& curGraph):
-  graph(curGraph)
-{
-  for (auto cIter(curGraph.nodes_.cbegin()); cIter != curGraph.nodes_.cend(); cIter++)
-  {
-    const Node& node = cIter->second;
-    unprocessedNodes.pushBack(node.name);
-    timeToNodes.insert({node.name, std::numeric_limits< size_t >::max()});
-  }
-}
-
-miheev::Graph::Path miheev::Graph::Dextra::operator()(int start, int finish)
-{
-  if (!graph.contains(start))
-  {
-    throw std::invalid_argument("[ERROR](navigation): no node " + std::to_string(start));
-  }
-  if (!graph.contains(finish))
-  {
-    throw std::invalid_argument("[ERROR](navigation): no node " + std::to_string(finish));
-  }
-  updateNodeState(start, 0);
-  calcMinTimeToEach();
-  Path path;
-  path.lenght = timeToNodes.at(finish);
-  path.path = findShortestPath(start, finish);
-  return path;
-}
-
-void miheev::Graph::Dextra::calcMinTimeToEach()
-{
-  while(!unprocessedNodes.empty())
-  {
-    int nameOfNodeWithMinimumTime = getNodeWithMinimumTimeToIt();
-    if (timeToNodes.at(nameOfNodeWithMinimumTime) == std::numeric_limits< size_t >::max())
-    {
-      return;
-    }
-    const Node& node = graph.nodes_.at(nameOfNodeWithMinimumTime);
-    recalculateTimeToNeighboursOfTheNode(node);
-    unprocessedNodes.remove(node.name);
-  }
-}
-
-void miheev::Graph::Dextra::recalculateTimeToNeighboursOfTheNode(const Node& node)
-{
-  for (auto iter(node.edges.cbegin()); iter != node.edges.cend(); iter++)
-  {
-    int neighbourName = iter->dest;
-    bool neighbourIsUnprocessed = unprocessedNodes.contains(neighbourName);
-    if (neighbourIsUnprocessed)
-    {
-      size_t timeToNeighbour = timeToNodes.at(node.name) + iter->weight;
-      if (timeToNeighbour < timeToNodes.at(neighbourName))
-      {
-        updateNodeState(neighbourName, timeToNeighbour, node.name);
-      }
-    }
-  }
-}
-
-int miheev::Graph::Dextra::getNodeWithMinimumTimeToIt()
-{
-  size_t minTime = std::numeric_limits< size_t >::max();
-  int node = -1;
-  for (auto iter(unprocessedNodes.cbegin()); iter != unprocessedNodes.cend(); iter++)
-  {
-    size_t curTime = timeToNodes.at(*iter);
-    if (curTime <= minTime)
-    {
-      node = *iter;
-      minTime = curTime;
-    }
-  }
-  return node;
-}
-
-miheev::List< int > miheev::Graph::Dextra::findShortestPath(int start, int finish)
-{
-  if (timeToNodes.at(finish) == std::numeric_limits< size_t >::max())
-  {
-    std::invalid_argument("[ERROR](navigation): no path exists from node " + std::to_string(start)
-     + " to node " + std::to_string(finish) + '\n');
-  }
-  miheev::List< int > path;
-  path.pushFront(finish);
-  do
-  {
-    int parentNode = nodesParrents.at(finish);
-    path.pushFront(parentNode);
-    finish = parentNode;
-  } while (finish != start);
-  return path;
-}
-
-void miheev::Graph::Dextra::updateNodeState(int node, size_t timeToNode, int parrentNode)
-{
-  timeToNodes[node] = timeToNode;
-  nodesParrents[node] = parrentNode;
-}
-
 bool isNewLine(std::istream& in)
 {
   in >> std::noskipws;
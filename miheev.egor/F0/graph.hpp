@@ -4,6 +4,7 @@
 #include <tree.hpp>
 #include <list.hpp>
 #include <iostream>
+#include "navigator.hpp"
 
 namespace miheev
 {
@@ -29,10 +30,10 @@ namespace miheev
   private:
     struct Node;
     Tree< int, Node > nodes_;
+    mutable Navigator navigator_;
 
     struct Edge;
     struct Printer;
-    struct Dextra;
   };
 
   struct Graph::Path
@@ -48,25 +49,6 @@ namespace miheev
     List< int > visitedNodes;
   };
 
-  struct Graph::Dextra
-  {
-    Dextra(const Graph&);
-
-    Path operator()(int begin, int end);
-
-    void calcMinTimeToEach();
-    int getNodeWithMinimumTimeToIt();
-    void recalculateTimeToNeighboursOfTheNode(const Node&);
-    List< int > findShortestPath(int start, int finish);
-
-    void updateNodeState(int node, size_t timeToNode, int parrentNode = -1);
-
-    const Graph& graph;
-    List< int > unprocessedNodes;
-    Tree <int, int> nodesParrents;
-    Tree< int, size_t > timeToNodes;
-  };
-
   struct Graph::Edge
   {
     int dest;
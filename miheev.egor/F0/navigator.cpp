@@ -0,0 +1,305 @@
+#include "navigator.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+const size_t miheev::Navigator::npos = std::numeric_limits< size_t >::max();
+const size_t miheev::Navigator::infinity = std::numeric_limits< size_t >::max();
+const size_t miheev::Navigator::maxTrees = 32;
+
+namespace
+{
+  using queue_t = std::priority_queue<
+    std::pair< size_t, size_t >,
+    std::vector< std::pair< size_t, size_t > >,
+    std::greater< std::pair< size_t, size_t > >
+  >;
+}
+
+miheev::Navigator::Navigator():
+  symmetric_(false),
+  nextTree_(0),
+  actual_(false)
+{}
+
+void miheev::Navigator::invalidate() noexcept
+{
+  actual_ = false;
+}
+
+bool miheev::Navigator::isActual() const noexcept
+{
+  return actual_;
+}
+
+size_t miheev::Navigator::route(int start, int finish, List< int >& path)
+{
+  size_t startId = getId(start);
+  size_t finishId = getId(finish);
+  if (startId == npos)
+  {
+    throw std::invalid_argument("[ERROR](navigation): no node " + std::to_string(start));
+  }
+  if (finishId == npos)
+  {
+    throw std::invalid_argument("[ERROR](navigation): no node " + std::to_string(finish));
+  }
+  path.clear();
+  if (startId == finishId)
+  {
+    path.pushBack(start);
+    return 0;
+  }
+
+  const ShortestTree* tree = findTree(startId);
+  bool fromFinish = false;
+  if (!tree && symmetric_)
+  {
+    tree = findTree(finishId);
+    fromFinish = tree != nullptr;
+  }
+  if (!tree && queried_[startId])
+  {
+    tree = std::addressof(buildTree(startId));
+  }
+
+  size_t length = infinity;
+  if (!tree)
+  {
+    queried_[startId] = true;
+    length = bidirectional(startId, finishId, path);
+  }
+  else if (fromFinish)
+  {
+    length = tree->distances[startId];
+    for (size_t id = startId; length != infinity && id != npos; id = tree->parents[id])
+    {
+      path.pushBack(names_[id]);
+    }
+  }
+  else
+  {
+    length = tree->distances[finishId];
+    for (size_t id = finishId; length != infinity && id != npos; id = tree->parents[id])
+    {
+      path.pushFront(names_[id]);
+    }
+  }
+
+  if (length == infinity)
+  {
+    throw std::invalid_argument("[ERROR](navigation): no path exists from node " + std::to_string(start)
+      + " to node " + std::to_string(finish));
+  }
+  return length;
+}
+
+size_t miheev::Navigator::getId(int name) const
+{
+  auto iter = std::lower_bound(names_.cbegin(), names_.cend(), name);
+  if (iter == names_.cend() || *iter != name)
+  {
+    return npos;
+  }
+  return static_cast< size_t >(iter - names_.cbegin());
+}
+
+void miheev::Navigator::beginSnapshot(size_t nodesCount)
+{
+  names_.clear();
+  names_.reserve(nodesCount);
+  offsets_.assign(1, 0);
+  offsets_.reserve(nodesCount + 1);
+  targets_.clear();
+  weights_.clear();
+  trees_.clear();
+  nextTree_ = 0;
+}
+
+void miheev::Navigator::finishSnapshot()
+{
+  size_t count = names_.size();
+  reverseOffsets_.assign(count + 1, 0);
+  for (size_t i = 0; i < targets_.size(); i++)
+  {
+    reverseOffsets_[targets_[i] + 1]++;
+  }
+  for (size_t node = 0; node < count; node++)
+  {
+    reverseOffsets_[node + 1] += reverseOffsets_[node];
+  }
+  sources_.resize(targets_.size());
+  reverseWeights_.resize(weights_.size());
+  std::vector< size_t > cursors(reverseOffsets_.cbegin(), reverseOffsets_.cend() - 1);
+  for (size_t node = 0; node < count; node++)
+  {
+    for (size_t i = offsets_[node]; i < offsets_[node + 1]; i++)
+    {
+      size_t slot = cursors[targets_[i]]++;
+      sources_[slot] = node;
+      reverseWeights_[slot] = weights_[i];
+    }
+  }
+
+  symmetric_ = true;
+  std::vector< std::pair< size_t, size_t > > outgoing;
+  std::vector< std::pair< size_t, size_t > > incoming;
+  for (size_t node = 0; symmetric_ && node < count; node++)
+  {
+    outgoing.clear();
+    incoming.clear();
+    for (size_t i = offsets_[node]; i < offsets_[node + 1]; i++)
+    {
+      outgoing.push_back({targets_[i], weights_[i]});
+    }
+    for (size_t i = reverseOffsets_[node]; i < reverseOffsets_[node + 1]; i++)
+    {
+      incoming.push_back({sources_[i], reverseWeights_[i]});
+    }
+    std::sort(outgoing.begin(), outgoing.end());
+    std::sort(incoming.begin(), incoming.end());
+    symmetric_ = outgoing == incoming;
+  }
+
+  queried_.assign(count, false);
+  forward_.assign(count, infinity);
+  backward_.assign(count, infinity);
+  forwardParents_.assign(count, npos);
+  backwardParents_.assign(count, npos);
+  touched_.clear();
+  actual_ = true;
+}
+
+const miheev::Navigator::ShortestTree* miheev::Navigator::findTree(size_t source) const
+{
+  for (auto iter(trees_.cbegin()); iter != trees_.cend(); iter++)
+  {
+    if (iter->source == source)
+    {
+      return std::addressof(*iter);
+    }
+  }
+  return nullptr;
+}
+
+const miheev::Navigator::ShortestTree& miheev::Navigator::buildTree(size_t source)
+{
+  ShortestTree tree{source, std::vector< size_t >(names_.size(), infinity), std::vector< size_t >(names_.size(), npos)};
+  queue_t queue;
+  tree.distances[source] = 0;
+  queue.push({0, source});
+  while (!queue.empty())
+  {
+    std::pair< size_t, size_t > top = queue.top();
+    queue.pop();
+    size_t node = top.second;
+    if (top.first > tree.distances[node])
+    {
+      continue;
+    }
+    for (size_t i = offsets_[node]; i < offsets_[node + 1]; i++)
+    {
+      size_t timeToNeighbour = top.first + weights_[i];
+      if (timeToNeighbour < tree.distances[targets_[i]])
+      {
+        tree.distances[targets_[i]] = timeToNeighbour;
+        tree.parents[targets_[i]] = node;
+        queue.push({timeToNeighbour, targets_[i]});
+      }
+    }
+  }
+
+  if (trees_.size() < maxTrees)
+  {
+    trees_.push_back(std::move(tree));
+    return trees_.back();
+  }
+  ShortestTree& replaced = trees_[nextTree_];
+  nextTree_ = (nextTree_ + 1) % maxTrees;
+  replaced = std::move(tree);
+  return replaced;
+}
+
+size_t miheev::Navigator::bidirectional(size_t start, size_t finish, List< int >& path)
+{
+  queue_t forwardQueue;
+  queue_t backwardQueue;
+  forward_[start] = 0;
+  backward_[finish] = 0;
+  touched_.push_back(start);
+  touched_.push_back(finish);
+  forwardQueue.push({0, start});
+  backwardQueue.push({0, finish});
+
+  size_t best = infinity;
+  size_t meeting = npos;
+  while (!forwardQueue.empty() && !backwardQueue.empty())
+  {
+    if (forwardQueue.top().first + backwardQueue.top().first >= best)
+    {
+      break;
+    }
+    bool isForward = forwardQueue.top().first <= backwardQueue.top().first;
+    queue_t& queue = isForward ? forwardQueue : backwardQueue;
+    std::vector< size_t >& times = isForward ? forward_ : backward_;
+    std::vector< size_t >& otherTimes = isForward ? backward_ : forward_;
+    std::vector< size_t >& parents = isForward ? forwardParents_ : backwardParents_;
+    const std::vector< size_t >& offsets = isForward ? offsets_ : reverseOffsets_;
+    const std::vector< size_t >& neighbours = isForward ? targets_ : sources_;
+    const std::vector< size_t >& weights = isForward ? weights_ : reverseWeights_;
+
+    std::pair< size_t, size_t > top = queue.top();
+    queue.pop();
+    size_t node = top.second;
+    if (top.first > times[node])
+    {
+      continue;
+    }
+    for (size_t i = offsets[node]; i < offsets[node + 1]; i++)
+    {
+      size_t neighbour = neighbours[i];
+      size_t timeToNeighbour = top.first + weights[i];
+      if (timeToNeighbour < times[neighbour])
+      {
+        if (times[neighbour] == infinity && otherTimes[neighbour] == infinity)
+        {
+          touched_.push_back(neighbour);
+        }
+        times[neighbour] = timeToNeighbour;
+        parents[neighbour] = node;
+        queue.push({timeToNeighbour, neighbour});
+      }
+      if (otherTimes[neighbour] != infinity && times[neighbour] + otherTimes[neighbour] < best)
+      {
+        best = times[neighbour] + otherTimes[neighbour];
+        meeting = neighbour;
+      }
+    }
+  }
+
+  if (meeting != npos)
+  {
+    for (size_t id = meeting; id != npos; id = forwardParents_[id])
+    {
+      path.pushFront(names_[id]);
+    }
+    for (size_t id = backwardParents_[meeting]; id != npos; id = backwardParents_[id])
+    {
+      path.pushBack(names_[id]);
+    }
+  }
+
+  for (auto iter(touched_.cbegin()); iter != touched_.cend(); iter++)
+  {
+    forward_[*iter] = infinity;
+    backward_[*iter] = infinity;
+    forwardParents_[*iter] = npos;
+    backwardParents_[*iter] = npos;
+  }
+  touched_.clear();
+  return best;
+}
@@ -0,0 +1,85 @@
+#ifndef NAVIGATOR_HPP
+#define NAVIGATOR_HPP
+
+#include <cstddef>
+#include <vector>
+#include <list.hpp>
+
+namespace miheev
+{
+  class Navigator
+  {
+  public:
+    Navigator();
+
+    void invalidate() noexcept;
+    bool isActual() const noexcept;
+
+    template< typename NodesTree >
+    void snapshot(const NodesTree& nodes);
+
+    size_t route(int start, int finish, List< int >& path);
+
+  private:
+    struct ShortestTree
+    {
+      size_t source;
+      std::vector< size_t > distances;
+      std::vector< size_t > parents;
+    };
+
+    static const size_t npos;
+    static const size_t infinity;
+    static const size_t maxTrees;
+
+    size_t getId(int name) const;
+    void beginSnapshot(size_t nodesCount);
+    void finishSnapshot();
+    const ShortestTree* findTree(size_t source) const;
+    const ShortestTree& buildTree(size_t source);
+    size_t bidirectional(size_t start, size_t finish, List< int >& path);
+
+    std::vector< int > names_;
+    std::vector< size_t > offsets_;
+    std::vector< size_t > targets_;
+    std::vector< size_t > weights_;
+    std::vector< size_t > reverseOffsets_;
+    std::vector< size_t > sources_;
+    std::vector< size_t > reverseWeights_;
+    bool symmetric_;
+
+    std::vector< ShortestTree > trees_;
+    size_t nextTree_;
+    std::vector< bool > queried_;
+
+    std::vector< size_t > forward_;
+    std::vector< size_t > backward_;
+    std::vector< size_t > forwardParents_;
+    std::vector< size_t > backwardParents_;
+    std::vector< size_t > touched_;
+    bool actual_;
+  };
+}
+
+template< typename NodesTree >
+void miheev::Navigator::snapshot(const NodesTree& nodes)
+{
+  beginSnapshot(nodes.size());
+  for (auto cIter(nodes.cbegin()); cIter != nodes.cend(); cIter++)
+  {
+    names_.push_back(cIter->first);
+  }
+  for (auto cIter(nodes.cbegin()); cIter != nodes.cend(); cIter++)
+  {
+    const auto& edges = cIter->second.edges;
+    for (auto edge(edges.cbegin()); edge != edges.cend(); edge++)
+    {
+      targets_.push_back(getId(edge->dest));
+      weights_.push_back(edge->weight);
+    }
+    offsets_.push_back(targets_.size());
+  }
+  finishSnapshot();
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef ARENA_QUEUE_HPP
+#define ARENA_QUEUE_HPP
+
+#include "nodeArena.hpp"
+
+namespace miheev
+{
+  template< typename T >
+  class ArenaQueue
+  {
+  public:
+    explicit ArenaQueue(NodeArena< T >& arena);
+    ArenaQueue(const ArenaQueue&) = delete;
+    ~ArenaQueue();
+
+    ArenaQueue& operator=(const ArenaQueue&) = delete;
+
+    bool empty() const noexcept;
+    const T& front() const;
+
+    void push(const T&);
+    void pop();
+    void clear() noexcept;
+  private:
+    NodeArena< T >& arena_;
+    typename NodeArena< T >::Node* head_;
+    typename NodeArena< T >::Node* tail_;
+  };
+}
+
+template< typename T >
+miheev::ArenaQueue< T >::ArenaQueue(NodeArena< T >& arena):
+  arena_(arena),
+  head_(nullptr),
+  tail_(nullptr)
+{}
+
+template< typename T >
+miheev::ArenaQueue< T >::~ArenaQueue()
+{
+  clear();
+}
+
+template< typename T >
+bool miheev::ArenaQueue< T >::empty() const noexcept
+{
+  return head_ == nullptr;
+}
+
+template< typename T >
+const T& miheev::ArenaQueue< T >::front() const
+{
+  return head_->data;
+}
+
+template< typename T >
+void miheev::ArenaQueue< T >::push(const T& value)
+{
+  typename NodeArena< T >::Node* node = arena_.acquire(value, nullptr);
+  if (tail_)
+  {
+    tail_->next = node;
+  }
+  else
+  {
+    head_ = node;
+  }
+  tail_ = node;
+}
+
+template< typename T >
+void miheev::ArenaQueue< T >::pop()
+{
+  typename NodeArena< T >::Node* old = head_;
+  head_ = head_->next;
+  if (!head_)
+  {
+    tail_ = nullptr;
+  }
+  arena_.release(old);
+}
+
+template< typename T >
+void miheev::ArenaQueue< T >::clear() noexcept
+{
+  while (head_)
+  {
+    pop();
+  }
+}
+
+#endif
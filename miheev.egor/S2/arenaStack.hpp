@@ -0,0 +1,88 @@
+#ifndef ARENA_STACK_HPP
+#define ARENA_STACK_HPP
+
+#include "nodeArena.hpp"
+
+namespace miheev
+{
+  template< typename T >
+  class ArenaStack
+  {
+  public:
+    explicit ArenaStack(NodeArena< T >& arena);
+    ArenaStack(const ArenaStack&) = delete;
+    ~ArenaStack();
+
+    ArenaStack& operator=(const ArenaStack&) = delete;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    const T& top() const;
+
+    void push(const T&);
+    void pop();
+    void clear() noexcept;
+  private:
+    NodeArena< T >& arena_;
+    typename NodeArena< T >::Node* head_;
+    size_t size_;
+  };
+}
+
+template< typename T >
+miheev::ArenaStack< T >::ArenaStack(NodeArena< T >& arena):
+  arena_(arena),
+  head_(nullptr),
+  size_(0)
+{}
+
+template< typename T >
+miheev::ArenaStack< T >::~ArenaStack()
+{
+  clear();
+}
+
+template< typename T >
+bool miheev::ArenaStack< T >::empty() const noexcept
+{
+  return head_ == nullptr;
+}
+
+template< typename T >
+size_t miheev::ArenaStack< T >::size() const noexcept
+{
+  return size_;
+}
+
+template< typename T >
+const T& miheev::ArenaStack< T >::top() const
+{
+  return head_->data;
+}
+
+template< typename T >
+void miheev::ArenaStack< T >::push(const T& value)
+{
+  head_ = arena_.acquire(value, head_);
+  size_++;
+}
+
+template< typename T >
+void miheev::ArenaStack< T >::pop()
+{
+  typename NodeArena< T >::Node* old = head_;
+  head_ = head_->next;
+  arena_.release(old);
+  size_--;
+}
+
+template< typename T >
+void miheev::ArenaStack< T >::clear() noexcept
+{
+  while (head_)
+  {
+    pop();
+  }
+}
+
+#endif
@@ -1,14 +1,10 @@
 #include "expressionElement.hpp"
 
 miheev::element_t::element_t():
-  type("none")
+  operand(),
+  type(ElementType::NONE)
 {}
 
-miheev::element_t::element_t(const element_t& rhs)
-{
-  *this = rhs;
-}
-
 const miheev::Operand& miheev::element_t::getOperand() const
 {
   return operand;
@@ -21,7 +17,7 @@ const miheev::Parenthesis& miheev::element_t::getParenthesis() const
 {
   return parenthesis;
 }
-const std::string miheev::element_t::getType() const
+miheev::ElementType miheev::element_t::getType() const
 {
   return type;
 }
@@ -29,49 +25,30 @@ const std::string miheev::element_t::getType() const
 void miheev::element_t::setOperand(const miheev::Operand& rhs)
 {
   operand = rhs;
-  type = "operand";
+  type = ElementType::OPERAND;
 }
 void miheev::element_t::setOperand(long long value)
 {
   operand.setValue(value);
-  type = "operand";
+  type = ElementType::OPERAND;
 }
 void miheev::element_t::setOperation(const miheev::Operation& rhs)
 {
   operation = rhs;
-  type = "operation";
+  type = ElementType::OPERATION;
 }
 void miheev::element_t::setOperation(char op)
 {
   operation.setOperation(op);
-  type = "operation";
+  type = ElementType::OPERATION;
 }
 void miheev::element_t::setParenthesis(const miheev::Parenthesis& rhs)
 {
   parenthesis = rhs;
-  type = "parenthesis";
+  type = ElementType::PARENTHESIS;
 }
 void miheev::element_t::setParenthesis(char par)
 {
   parenthesis.parenthesis = par;
-  type = "parenthesis";
-}
-
-
-miheev::element_t& miheev::element_t::operator=(const element_t& rhs)
-{
-  type = rhs.type;
-  if (rhs.type == "operation")
-  {
-    operation = Operation(rhs.operation.getOperation());
-  }
-  else if (rhs.type == "operand")
-  {
-    operand = Operand(rhs.operand.getValue());
-  }
-  else if (rhs.type == "parenthesis")
-  {
-    parenthesis = Parenthesis{rhs.parenthesis.parenthesis};
-  }
-  return *this;
+  type = ElementType::PARENTHESIS;
 }
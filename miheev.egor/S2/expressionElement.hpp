@@ -3,21 +3,26 @@
 
 #include "operations.hpp"
 #include "operands.hpp"
-#include "string"
 
 namespace miheev
 {
+  enum class ElementType: unsigned char
+  {
+    NONE,
+    OPERAND,
+    OPERATION,
+    PARENTHESIS
+  };
+
   struct element_t
   {
   public:
     element_t();
-    element_t(const element_t&);
-    element_t& operator=(const element_t&);
 
     const Operand& getOperand() const;
     const Operation& getOperation() const;
     const Parenthesis& getParenthesis() const;
-    const std::string getType() const;
+    ElementType getType() const;
 
     void setOperand(const Operand& rhs);
     void setOperand(long long);
@@ -27,10 +32,13 @@ namespace miheev
     void setParenthesis(char);
 
   private:
-    Operand operand;
-    Operation operation;
-    Parenthesis parenthesis;
-    std::string type;
+    union
+    {
+      Operand operand;
+      Operation operation;
+      Parenthesis parenthesis;
+    };
+    ElementType type;
   };
 }
 
@@ -1,68 +1,73 @@
 #include "inputProcessing.hpp"
-#include "expressionElement.hpp"
-#include "postfixElement.hpp"
-#include "queue.hpp"
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include "arenaQueue.hpp"
+#include "arenaStack.hpp"
 
 namespace miheev
 {
-  std::string getSymbol(std::string&);
-  element_t convertToElement(std::string);
-  element_t getElement(std::string&);
-  Queue< postfix_t > lineToPosfix(std::string line);
-  long long calcLine(std::string);
-  void printTypes(miheev::Queue< element_t >);
+  long long parseOperand(const char* begin, const char* end);
+  element_t convertToElement(const char* begin, const char* end);
+  void lineToPosfix(const std::string& line, ArenaStack< element_t >& stack, ArenaQueue< postfix_t >& queue);
 }
 
-std::string miheev::getSymbol(std::string& s)
+long long miheev::parseOperand(const char* begin, const char* end)
 {
-  std::string symbol = s.substr(0, s.find(" "));
-  if (s.find(" ") == std::string::npos)
+  while (begin != end && std::isspace(static_cast< unsigned char >(*begin)))
   {
-    s = "";
+    begin++;
   }
-  else
+  bool negative = begin != end && *begin == '-';
+  if (begin != end && (*begin == '-' || *begin == '+'))
+  {
+    begin++;
+  }
+  if (begin == end || !std::isdigit(static_cast< unsigned char >(*begin)))
   {
-    s = s.substr(s.find(" ") + 1);
+    throw std::invalid_argument("stoll");
+  }
+  long long limit = negative ? std::numeric_limits< long long >::min() : -std::numeric_limits< long long >::max();
+  long long value = 0;
+  for (; begin != end && std::isdigit(static_cast< unsigned char >(*begin)); begin++)
+  {
+    int digit = *begin - '0';
+    if (value < (limit + digit) / 10)
+    {
+      throw std::out_of_range("stoll");
+    }
+    value = value * 10 - digit;
   }
-  return symbol;
+  return negative ? value : -value;
 }
 
-miheev::element_t miheev::convertToElement(std::string s)
+miheev::element_t miheev::convertToElement(const char* begin, const char* end)
 {
   miheev::element_t result;
-  if (s == "+" || s == "-" || s == "*" || s == "/" || s == "%")
+  char first = (begin != end) ? *begin : '\0';
+  bool single = end - begin == 1;
+  if (single && (first == '+' || first == '-' || first == '*' || first == '/' || first == '%'))
   {
-    result.setOperation(s[0]);
+    result.setOperation(first);
   }
-  else if (s == "(")
+  else if (single && (first == '(' || first == ')'))
   {
-    result.setParenthesis(s[0]);
-  }
-  else if (s == ")")
-  {
-    result.setParenthesis(')');
+    result.setParenthesis(first);
   }
   else
   {
-    result.setOperand(stoll(s));
+    result.setOperand(parseOperand(begin, end));
   }
   return result;
 }
 
-miheev::element_t miheev::getElement(std::string& s)
-{
-  std::string symbol = getSymbol(s);
-  miheev::element_t element = miheev::convertToElement(symbol);
-  return element;
-}
-
-bool isOpeningParenthesisOnTop(const miheev::Stack< miheev::element_t >& stack)
+bool isOpeningParenthesisOnTop(const miheev::ArenaStack< miheev::element_t >& stack)
 {
   if (stack.empty())
   {
     return false;
   }
-  bool parenthesisOnTop = stack.top().getType() != "parenthesis";
+  bool parenthesisOnTop = stack.top().getType() != miheev::ElementType::PARENTHESIS;
   if (parenthesisOnTop)
   {
     return false;
@@ -75,13 +80,13 @@ bool isOpeningParenthesisOnTop(const miheev::Stack< miheev::element_t >& stack)
   return true;
 }
 
-bool shouldPushOpToStack(const miheev::Stack< miheev::element_t >& stack, const miheev::element_t& curr)
+bool shouldPushOpToStack(const miheev::ArenaStack< miheev::element_t >& stack, const miheev::element_t& curr)
 {
   if (stack.empty())
   {
     return true;
   }
-  bool operationOnTop = stack.top().getType() != "operation";
+  bool operationOnTop = stack.top().getType() != miheev::ElementType::OPERATION;
   if (operationOnTop)
   {
     return true;
@@ -94,15 +99,21 @@ bool shouldPushOpToStack(const miheev::Stack< miheev::element_t >& stack, const
   return false;
 }
 
-miheev::Queue< miheev::postfix_t > miheev::lineToPosfix(std::string line)
+void miheev::lineToPosfix(const std::string& line, ArenaStack< element_t >& stack, ArenaQueue< postfix_t >& queue)
 {
-  Stack< miheev::element_t > stack;
-  Queue< miheev::postfix_t > queue;
-  miheev::element_t current;
-  while (line != "")
+  const char* begin = line.data();
+  const char* end = begin + line.size();
+  while (begin != end)
   {
-    current = getElement(line);
-    if (current.getType() == "parenthesis")
+    const char* space = begin;
+    while (space != end && *space != ' ')
+    {
+      space++;
+    }
+    element_t current = convertToElement(begin, space);
+    begin = (space == end) ? end : space + 1;
+
+    if (current.getType() == ElementType::PARENTHESIS)
     {
       if (current.getParenthesis().parenthesis == '(')
       {
@@ -112,62 +123,57 @@ miheev::Queue< miheev::postfix_t > miheev::lineToPosfix(std::string line)
       {
         while (!isOpeningParenthesisOnTop(stack))
         {
-          miheev::postfix_t temp(stack.top());
+          if (stack.empty())
+          {
+            throw std::logic_error("closing parenthesis has no pair. check your expression");
+          }
+          queue.push(postfix_t(stack.top()));
           stack.pop();
-          queue.push(temp);
         }
         stack.pop();
       }
     }
-    else if (current.getType() == "operand")
+    else if (current.getType() == ElementType::OPERAND)
     {
-      miheev::postfix_t temp(current);
-      queue.push(temp);
+      queue.push(postfix_t(current));
     }
-    else if (current.getType() == "operation")
+    else if (current.getType() == ElementType::OPERATION)
     {
       while (!shouldPushOpToStack(stack, current))
       {
-        miheev::postfix_t temp(stack.top());
+        queue.push(postfix_t(stack.top()));
         stack.pop();
-        queue.emplace(temp);
       }
       stack.push(current);
     }
   }
   while (!stack.empty())
   {
-    miheev::postfix_t temp(stack.top());
-    queue.push(temp);
+    queue.push(postfix_t(stack.top()));
     stack.pop();
   }
-  return queue;
-}
-
-void miheev::printTypes(miheev::Queue< miheev::element_t > q)
-{
-  while (!q.empty())
-  {
-    std::cout << q.front().getType() << ' ';
-    q.pop();
-  }
-  std::cout << '\n';
 }
 
-long long miheev::calcLine(std::string line)
+long long miheev::calcLine(const std::string& line, ExpressionArena& arena)
 {
-  miheev::Stack< Operand > stack;
-  Queue< miheev::postfix_t > postfix = miheev::lineToPosfix(line);
+  ArenaStack< element_t > operations(arena.elements);
+  ArenaQueue< postfix_t > postfix(arena.postfix);
+  ArenaStack< Operand > stack(arena.operands);
+  lineToPosfix(line, operations, postfix);
   while (!postfix.empty())
   {
-    miheev::postfix_t current = postfix.front();
+    postfix_t current = postfix.front();
     postfix.pop();
-    if (current.getType() == "operand")
+    if (current.getType() == ElementType::OPERAND)
     {
       stack.push(current.getOperand());
     }
-    else if(current.getType() == "operation")
+    else if (current.getType() == ElementType::OPERATION)
     {
+      if (stack.size() < 2)
+      {
+        throw std::runtime_error("not enough operands. check your expression");
+      }
       Operand rhs = stack.top();
       stack.pop();
       Operand lhs = stack.top();
@@ -183,20 +189,24 @@ long long miheev::calcLine(std::string line)
   {
     throw std::runtime_error("not all operands are used. check your expression");
   }
+  if (stack.empty())
+  {
+    throw std::runtime_error("not enough operands. check your expression");
+  }
   return stack.top().getValue();
 }
 
 miheev::Stack< long long > miheev::processInput(std::istream& in)
 {
   Stack< long long > results;
-  Queue< element_t > postfix;
+  ExpressionArena arena;
   std::string line = "";
   while (!in.eof())
   {
     std::getline(in, line);
     if (line != "")
     {
-      results.push(miheev::calcLine(line));
+      results.push(miheev::calcLine(line, arena));
     }
   }
   return results;
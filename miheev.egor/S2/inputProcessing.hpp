@@ -2,12 +2,22 @@
 #define INPUT_PROCESSING_HPP
 
 #include <ios>
+#include <string>
 #include "stack.hpp"
-#include "queue.hpp"
+#include "nodeArena.hpp"
 #include "expressionElement.hpp"
+#include "postfixElement.hpp"
 
 namespace miheev
 {
+  struct ExpressionArena
+  {
+    NodeArena< element_t > elements;
+    NodeArena< postfix_t > postfix;
+    NodeArena< Operand > operands;
+  };
+
+  long long calcLine(const std::string&, ExpressionArena&);
   Stack< long long > processInput(std::istream&);
 }
 
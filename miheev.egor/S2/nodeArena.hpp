@@ -0,0 +1,69 @@
+#ifndef NODE_ARENA_HPP
+#define NODE_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace miheev
+{
+  template< typename T >
+  class NodeArena
+  {
+  public:
+    struct Node
+    {
+      T data;
+      Node* next;
+    };
+
+    NodeArena();
+    NodeArena(const NodeArena&) = delete;
+    ~NodeArena() = default;
+
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    Node* acquire(const T& data, Node* next);
+    void release(Node* node) noexcept;
+  private:
+    static const size_t blockSize_ = 64;
+
+    Node* free_;
+    std::vector< std::unique_ptr< Node[] > > blocks_;
+  };
+}
+
+template< typename T >
+miheev::NodeArena< T >::NodeArena():
+  free_(nullptr),
+  blocks_()
+{}
+
+template< typename T >
+typename miheev::NodeArena< T >::Node* miheev::NodeArena< T >::acquire(const T& data, Node* next)
+{
+  if (!free_)
+  {
+    blocks_.emplace_back(new Node[blockSize_]);
+    Node* block = blocks_.back().get();
+    for (size_t i = 0; i < blockSize_; i++)
+    {
+      block[i].next = (i + 1 < blockSize_) ? &block[i + 1] : nullptr;
+    }
+    free_ = block;
+  }
+  Node* node = free_;
+  free_ = free_->next;
+  node->data = data;
+  node->next = next;
+  return node;
+}
+
+template< typename T >
+void miheev::NodeArena< T >::release(Node* node) noexcept
+{
+  node->next = free_;
+  free_ = node;
+}
+
+#endif
@@ -1,41 +1,24 @@
 #include "postfixElement.hpp"
 
 miheev::postfix_t::postfix_t():
-  type("none")
+  operand(),
+  type(ElementType::NONE)
 {}
 
-miheev::postfix_t::postfix_t(const miheev::postfix_t& rhs)
+miheev::postfix_t::postfix_t(const miheev::element_t& rhs):
+  operand(),
+  type(rhs.getType())
 {
-  *this = rhs;
-}
-
-miheev::postfix_t::postfix_t(const miheev::element_t& rhs)
-{
-  type = rhs.getType();
-  if (rhs.getType() == "operand")
+  if (type == ElementType::OPERAND)
   {
     operand = rhs.getOperand();
   }
-  else if (rhs.getType() == "operation")
+  else if (type == ElementType::OPERATION)
   {
     operation = rhs.getOperation();
   }
 }
 
-miheev::postfix_t& miheev::postfix_t::operator=(const miheev::postfix_t& rhs)
-{
-  type = rhs.type;
-  if (rhs.type == "operand")
-  {
-    operand = rhs.operand;
-  }
-  else if (rhs.type == "operation")
-  {
-    operation = rhs.operation;
-  }
-  return *this;
-}
-
 const miheev::Operand& miheev::postfix_t::getOperand() const
 {
   return operand;
@@ -46,7 +29,7 @@ const miheev::Operation& miheev::postfix_t::getOperation() const
   return operation;
 }
 
-const std::string miheev::postfix_t::getType() const
+miheev::ElementType miheev::postfix_t::getType() const
 {
   return type;
 }
@@ -54,11 +37,11 @@ const std::string miheev::postfix_t::getType() const
 void miheev::postfix_t::setOperand(const miheev::Operand& rhs)
 {
   operand.setValue(rhs.getValue());
-  type = "operand";
+  type = ElementType::OPERAND;
 }
 
 void miheev::postfix_t::setOperation(const miheev::Operation& rhs)
 {
   operation.setOperation(rhs.getOperation());
-  type = "operation";
+  type = ElementType::OPERATION;
 }
@@ -9,21 +9,22 @@ namespace miheev
   {
   public:
     postfix_t();
-    postfix_t(const postfix_t&);
     explicit postfix_t(const element_t&);
-    postfix_t& operator=(const postfix_t&);
 
     const Operand& getOperand() const;
     const Operation& getOperation() const;
-    const std::string getType() const;
+    ElementType getType() const;
 
     void setOperand(const Operand& rhs);
     void setOperation(const Operation& rhs);
 
   private:
-    Operand operand;
-    Operation operation;
-    std::string type;
+    union
+    {
+      Operand operand;
+      Operation operation;
+    };
+    ElementType type;
   };
 }
 
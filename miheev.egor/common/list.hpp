@@ -118,6 +118,10 @@ private:
 template< typename T >
 typename miheev::List< T >::ConstIterator miheev::List< T >::cbegin() const
 {
+  if (isEmpty_)
+  {
+    return nullptr;
+  }
   return this;
 }
 
@@ -130,6 +134,10 @@ typename miheev::List< T >::ConstIterator miheev::List< T >::cend() const
 template< typename T >
 typename miheev::List< T >::Iterator miheev::List< T >::begin()
 {
+  if (isEmpty_)
+  {
+    return nullptr;
+  }
   return this;
 }
 
@@ -524,16 +532,23 @@ void miheev::List< T >::eraseAfter(miheev::List< T >::Iterator iter)
 template < typename T >
 void miheev::List< T >::remove(T data)
 {
+  if (isEmpty_)
+  {
+    return;
+  }
   Iterator iter(begin());
-  while(iter != nullptr)
+  while(iter.next() != nullptr)
   {
-    if (iter.next() != nullptr && *(iter.next()) == data)
+    if (*(iter.next()) == data)
     {
       iter.eraseAfter();
     }
-    iter++;
+    else
+    {
+      iter++;
+    }
   }
-  if (data_ == data)
+  while (!isEmpty_ && data_ == data)
   {
     popFront();
   }
@@ -558,6 +573,10 @@ template < typename T >
 template < typename P >
 void miheev::List< T >::removeIf(P functor)
 {
+  if (isEmpty_)
+  {
+    return;
+  }
   Iterator iter(begin());
 
   while (functor(*iter))
@@ -607,6 +626,10 @@ void miheev::List< T >::popBack()
 template < typename T >
 bool miheev::List< T >::contains(const T& value) const
 {
+  if (isEmpty_)
+  {
+    return false;
+  }
   if (data_ == value)
   {
     return true;
@@ -1127,7 +1127,9 @@ void miheev::Tree< Key, Value, Comparator>::rotateRR()
   left_ = right_->left_;
   right_->left_ = right_->right_;
   right_->right_ = buff;
+  right_->updateParrentsLocally();
   right_->updateHeight();
+  updateParrentsLocally();
   updateHeight();
 }
 
@@ -1140,7 +1142,9 @@ void miheev::Tree< Key, Value, Comparator>::rotateLL()
   right_ = left_->right_;
   left_->right_ = left_->left_;
   left_->left_ = buff;
+  left_->updateParrentsLocally();
   left_->updateHeight();
+  updateParrentsLocally();
   updateHeight();
 }
 
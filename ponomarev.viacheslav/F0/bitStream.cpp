@@ -0,0 +1,273 @@
+#include "bitStream.hpp"
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+namespace
+{
+  constexpr size_t chunkSize = 1 << 16;
+  constexpr char magic[] = "HUF1";
+  constexpr size_t magicSize = 4;
+
+  unsigned long long getMask(size_t length)
+  {
+    return (length >= 64) ? ~0ULL : ((1ULL << length) - 1);
+  }
+
+  void writeNumber(std::ostream & out, unsigned long long value, size_t bytes)
+  {
+    for (size_t i = 0; i < bytes; i++)
+    {
+      out.put(static_cast< char >((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  unsigned long long readNumber(std::istream & in, size_t bytes)
+  {
+    unsigned long long value = 0;
+    for (size_t i = 0; i < bytes; i++)
+    {
+      int byte = in.get();
+      if (byte == std::istream::traits_type::eof())
+      {
+        throw std::logic_error("error: broken header of the encoded file");
+      }
+      value |= static_cast< unsigned long long >(byte) << (8 * i);
+    }
+    return value;
+  }
+
+  void fillBitCodes(ponomarev::MinHeapNode * root, unsigned long long bits, size_t length, ponomarev::BitCode * codes)
+  {
+    if (root == nullptr)
+    {
+      return;
+    }
+    if ((root->left == nullptr) && (root->right == nullptr))
+    {
+      codes[static_cast< unsigned char >(root->data)] = { bits, length };
+      return;
+    }
+    if (length == 64)
+    {
+      throw std::logic_error("error: huffman code is longer than 64 bits");
+    }
+    fillBitCodes(root->left, bits << 1, length + 1, codes);
+    fillBitCodes(root->right, (bits << 1) | 1, length + 1, codes);
+  }
+}
+
+ponomarev::BitWriter::BitWriter(std::ostream & out):
+  out_(out),
+  acc_(0),
+  count_(0),
+  used_(0)
+{}
+
+void ponomarev::BitWriter::write(unsigned long long bits, size_t length)
+{
+  while (length != 0)
+  {
+    size_t take = std::min(64 - count_, length);
+    unsigned long long chunk = (bits >> (length - take)) & getMask(take);
+    acc_ = (take == 64) ? chunk : ((acc_ << take) | chunk);
+    count_ += take;
+    length -= take;
+
+    if (count_ == 64)
+    {
+      for (int shift = 56; shift >= 0; shift -= 8)
+      {
+        putByte(static_cast< unsigned char >(acc_ >> shift));
+      }
+      acc_ = 0;
+      count_ = 0;
+    }
+  }
+}
+
+void ponomarev::BitWriter::finish()
+{
+  if (count_ != 0)
+  {
+    unsigned long long rest = acc_ << (64 - count_);
+    for (size_t i = 0; i < (count_ + 7) / 8; i++)
+    {
+      putByte(static_cast< unsigned char >(rest >> (56 - 8 * i)));
+    }
+    acc_ = 0;
+    count_ = 0;
+  }
+  flushBuffer();
+}
+
+void ponomarev::BitWriter::putByte(unsigned char byte)
+{
+  if (used_ == bufferSize)
+  {
+    flushBuffer();
+  }
+  buffer_[used_++] = static_cast< char >(byte);
+}
+
+void ponomarev::BitWriter::flushBuffer()
+{
+  out_.write(buffer_, used_);
+  used_ = 0;
+}
+
+ponomarev::BitReader::BitReader(std::istream & in):
+  in_(in),
+  acc_(0),
+  count_(0),
+  pos_(0),
+  available_(0)
+{}
+
+bool ponomarev::BitReader::readBit()
+{
+  if (count_ == 0)
+  {
+    refill();
+  }
+  bool bit = (acc_ >> 63) != 0;
+  acc_ <<= 1;
+  count_--;
+  return bit;
+}
+
+void ponomarev::BitReader::refill()
+{
+  while (count_ < 64)
+  {
+    if (pos_ == available_)
+    {
+      in_.read(buffer_, bufferSize);
+      available_ = static_cast< size_t >(in_.gcount());
+      pos_ = 0;
+      if (available_ == 0)
+      {
+        break;
+      }
+    }
+    acc_ |= static_cast< unsigned long long >(static_cast< unsigned char >(buffer_[pos_++])) << (56 - count_);
+    count_ += 8;
+  }
+
+  if (count_ == 0)
+  {
+    throw std::logic_error("error: unexpected end of the encoded data");
+  }
+}
+
+void ponomarev::compressStream(std::istream & input, std::ostream & output)
+{
+  char chunk[chunkSize];
+  unsigned long long counts[256] = {};
+  std::istream::pos_type start = input.tellg();
+
+  while (input.read(chunk, chunkSize) || input.gcount() != 0)
+  {
+    size_t readCount = static_cast< size_t >(input.gcount());
+    for (size_t i = 0; i < readCount; i++)
+    {
+      counts[static_cast< unsigned char >(chunk[i])]++;
+    }
+  }
+
+  HuffmanCode data;
+  for (size_t i = 0; i < 256; i++)
+  {
+    if (counts[i] != 0)
+    {
+      data.freq[static_cast< char >(i)] = counts[i];
+    }
+  }
+
+  output.write(magic, magicSize);
+  writeNumber(output, data.freq.getSize(), 2);
+  for (BSTree< char, size_t, int >::Iterator v = data.freq.begin(); v != data.freq.end(); v++)
+  {
+    output.put(v->first);
+    writeNumber(output, v->second, 8);
+  }
+  if (data.freq.isEmpty())
+  {
+    return;
+  }
+
+  createTree(data);
+  BitCode codes[256] = {};
+  fillBitCodes(data.minHeap.getElem(), 0, 0, codes);
+
+  input.clear();
+  input.seekg(start);
+  BitWriter writer(output);
+  while (input.read(chunk, chunkSize) || input.gcount() != 0)
+  {
+    size_t readCount = static_cast< size_t >(input.gcount());
+    for (size_t i = 0; i < readCount; i++)
+    {
+      const BitCode & code = codes[static_cast< unsigned char >(chunk[i])];
+      writer.write(code.bits, code.length);
+    }
+  }
+  writer.finish();
+}
+
+void ponomarev::decompressStream(std::istream & input, std::ostream & output)
+{
+  char header[magicSize];
+  if (!input.read(header, magicSize) || std::memcmp(header, magic, magicSize) != 0)
+  {
+    throw std::logic_error("error: the file is not huffman encoded");
+  }
+
+  size_t distinct = readNumber(input, 2);
+  if (distinct > 256)
+  {
+    throw std::logic_error("error: broken header of the encoded file");
+  }
+
+  HuffmanCode data;
+  unsigned long long total = 0;
+  for (size_t i = 0; i < distinct; i++)
+  {
+    int symbol = input.get();
+    if (symbol == std::istream::traits_type::eof())
+    {
+      throw std::logic_error("error: broken header of the encoded file");
+    }
+    unsigned long long freq = readNumber(input, 8);
+    data.freq[static_cast< char >(symbol)] = freq;
+    total += freq;
+  }
+  if (distinct == 0)
+  {
+    return;
+  }
+
+  createTree(data);
+  MinHeapNode * root = data.minHeap.getElem();
+  BitReader reader(input);
+  char chunk[chunkSize];
+  size_t used = 0;
+
+  for (unsigned long long i = 0; i < total; i++)
+  {
+    MinHeapNode * curr = root;
+    while ((curr->left != nullptr) || (curr->right != nullptr))
+    {
+      curr = reader.readBit() ? curr->right : curr->left;
+    }
+    chunk[used++] = curr->data;
+    if (used == chunkSize)
+    {
+      output.write(chunk, used);
+      used = 0;
+    }
+  }
+  output.write(chunk, used);
+}
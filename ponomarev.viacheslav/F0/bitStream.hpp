@@ -0,0 +1,65 @@
+#ifndef BIT_STREAM_HPP
+#define BIT_STREAM_HPP
+
+#include <cstddef>
+#include <iosfwd>
+#include "codingHuffman.hpp"
+
+namespace ponomarev
+{
+  struct BitCode
+  {
+    unsigned long long bits;
+    size_t length;
+  };
+
+  class BitWriter
+  {
+  public:
+    explicit BitWriter(std::ostream & out);
+    BitWriter(const BitWriter &) = delete;
+    BitWriter & operator=(const BitWriter &) = delete;
+
+    void write(unsigned long long bits, size_t length);
+    void finish();
+
+  private:
+    static constexpr size_t bufferSize = 1 << 16;
+
+    std::ostream & out_;
+    unsigned long long acc_;
+    size_t count_;
+    char buffer_[bufferSize];
+    size_t used_;
+
+    void putByte(unsigned char byte);
+    void flushBuffer();
+  };
+
+  class BitReader
+  {
+  public:
+    explicit BitReader(std::istream & in);
+    BitReader(const BitReader &) = delete;
+    BitReader & operator=(const BitReader &) = delete;
+
+    bool readBit();
+
+  private:
+    static constexpr size_t bufferSize = 1 << 16;
+
+    std::istream & in_;
+    unsigned long long acc_;
+    size_t count_;
+    char buffer_[bufferSize];
+    size_t pos_;
+    size_t available_;
+
+    void refill();
+  };
+
+  void compressStream(std::istream & input, std::ostream & output);
+  void decompressStream(std::istream & input, std::ostream & output);
+}
+
+#endif
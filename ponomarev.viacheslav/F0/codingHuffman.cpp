@@ -1,26 +1,52 @@
 #include "codingHuffman.hpp"
 #include <fstream>
 #include <iostream>
+#include <new>
 #include "accessoryFunctions.hpp"
 
-ponomarev::MinHeapNode::MinHeapNode(char data, int freq)
+ponomarev::MinHeapNode::MinHeapNode(char data, size_t freq)
 {
   left = right = nullptr;
   this->data = data;
   this->freq = freq;
 }
 
-bool ponomarev::Compare::operator()(MinHeapNode * l, MinHeapNode * r)
+bool ponomarev::Compare::operator()(const MinHeapNode * l, const MinHeapNode * r) const
 {
   return (l->freq > r->freq);
 }
 
+ponomarev::NodeArena::NodeArena():
+  nodes_(static_cast< MinHeapNode * >(::operator new(capacity * sizeof(MinHeapNode)))),
+  size_(0)
+{}
+
+ponomarev::NodeArena::~NodeArena()
+{
+  ::operator delete(nodes_);
+}
+
+ponomarev::MinHeapNode * ponomarev::NodeArena::create(char data, size_t freq)
+{
+  if (size_ == capacity)
+  {
+    throw std::logic_error("error: too many nodes in the huffman tree");
+  }
+  return new (nodes_ + size_++) MinHeapNode(data, freq);
+}
+
+void ponomarev::NodeArena::clear() noexcept
+{
+  size_ = 0;
+}
+
 ponomarev::HuffmanCode::HuffmanCode():
   codes(),
   freq(),
   text(),
   decodingText(),
-  minHeap()
+  minHeap(),
+  nodes()
 {}
 
 void ponomarev::printCodes(MinHeapNode * root, std::string str)
@@ -66,9 +92,16 @@ void ponomarev::createTree(HuffmanCode & data)
 {
     MinHeapNode * left, * right, * top;
 
-    for (BSTree < char, int, int >::Iterator v = data.freq.begin(); v != data.freq.end(); v++)
+    data.minHeap.clear();
+    data.nodes.clear();
+    if (data.freq.isEmpty())
+    {
+        return;
+    }
+    data.minHeap.reserve(data.freq.getSize());
+    for (BSTree < char, size_t, int >::Iterator v = data.freq.begin(); v != data.freq.end(); v++)
     {
-        data.minHeap.push(new MinHeapNode(v->first, v->second));
+        data.minHeap.push(data.nodes.create(v->first, v->second));
     }
     while (data.minHeap.getSize() != 1)
     {
@@ -76,7 +109,7 @@ void ponomarev::createTree(HuffmanCode & data)
         data.minHeap.pop();
         right = data.minHeap.getElem();
         data.minHeap.pop();
-        top = new MinHeapNode('$', left->freq + right->freq);
+        top = data.nodes.create('$', left->freq + right->freq);
         top->left = left;
         top->right = right;
         data.minHeap.push(top);
@@ -95,6 +128,11 @@ void ponomarev::calcFreq(std::string str, HuffmanCode & data)
 
 void ponomarev::decodeFile(HuffmanCode & data)
 {
+    if (data.minHeap.isEmpty())
+    {
+      data.text = "";
+      return;
+    }
     MinHeapNode * root = data.minHeap.getElem();
     MinHeapNode * curr = root;
     std::string s = data.decodingText;
@@ -109,11 +147,11 @@ void ponomarev::decodeFile(HuffmanCode & data)
       else
       {
         curr = curr->right;
-        if ((curr->left == nullptr) && (curr->right == nullptr))
-        {
-          ans += curr->data;
-          curr = root;
-        }
+      }
+      if ((curr->left == nullptr) && (curr->right == nullptr))
+      {
+        ans += curr->data;
+        curr = root;
       }
     }
     data.text = ans;
@@ -153,7 +191,7 @@ void ponomarev::fillFreq(std::string parameter, HuffmanCode & data)
   while (input >> str)
   {
     char symbol = cutType(str)[0];
-    int freq = std::stoi(str);
+    size_t freq = std::stoull(str);
     data.freq[symbol] = freq;
   }
   ponomarev::printSuccessfullyFrequenceInput(std::cout);
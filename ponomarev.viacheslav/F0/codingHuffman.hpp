@@ -3,23 +3,42 @@
 
 #include <string>
 #include "list.hpp"
-#include "queue.hpp"
+#include "heap.hpp"
 #include "binarySearchTreeAVL.hpp"
 
 namespace ponomarev
 {
   struct MinHeapNode
   {
-    MinHeapNode(char data, int freq);
+    MinHeapNode(char data, size_t freq);
 
     char data;
-    int freq;
+    size_t freq;
     MinHeapNode * left, * right;
   };
 
   struct Compare
   {
-    bool operator()(MinHeapNode * l, MinHeapNode * r);
+    bool operator()(const MinHeapNode * l, const MinHeapNode * r) const;
+  };
+
+  class NodeArena
+  {
+  public:
+    NodeArena();
+    NodeArena(const NodeArena &) = delete;
+    ~NodeArena();
+
+    NodeArena & operator=(const NodeArena &) = delete;
+
+    MinHeapNode * create(char data, size_t freq);
+    void clear() noexcept;
+
+  private:
+    static constexpr size_t capacity = 2 * 256 - 1;
+
+    MinHeapNode * nodes_;
+    size_t size_;
   };
 
   class HuffmanCode
@@ -28,10 +47,11 @@ namespace ponomarev
     HuffmanCode();
 
     BSTree < char, std::string, int > codes;
-    BSTree < char, int, int > freq;
+    BSTree < char, size_t, int > freq;
     std::string text;
     std::string decodingText;
-    Queue < MinHeapNode * > minHeap;
+    Heap < MinHeapNode *, Compare > minHeap;
+    NodeArena nodes;
     List< std::string > fileNames;
   };
 
@@ -1,7 +1,11 @@
 #include "commands.hpp"
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include "accessoryFunctions.hpp"
+#include "bitStream.hpp"
 
 void ponomarev::outputInfoAboutCommands(const std::string & parameters, ponomarev::HuffmanCode &)
 {
@@ -31,6 +35,10 @@ void ponomarev::outputInfoAboutCommands(const std::string & parameters, ponomare
     std::cout << "14) 'table' - output of the character encoding table for the encoding result\n";
     std::cout << "15) 'save <filename>' - saving the result of the work to a new txt file filename\n";
     std::cout << "------------------------------------------------------------------------\n";
+    std::cout << "16) 'compress <filename1> <filename2>' - pack filename1 into the bit-stream file filename2\n";
+    std::cout << "17) 'decompress <filename1> <filename2>' - unpack the bit-stream file filename1 into filename2\n";
+    std::cout << "18) 'benchmark <filename>' - compare throughput of the string and bit-stream coding on filename\n";
+    std::cout << "------------------------------------------------------------------------\n";
   }
   else
   {
@@ -168,6 +176,10 @@ void ponomarev::showTable(std::string & parameters, HuffmanCode & data)
     throw std::logic_error("error: wrong parameters");
   }
 
+  if (data.minHeap.isEmpty())
+  {
+    throw std::logic_error("error: nothing to show");
+  }
   printCodes(data.minHeap.getElem(), "");
 }
 
@@ -271,3 +283,114 @@ void ponomarev::makeSave(std::string & parameters, HuffmanCode & data)
   data.fileNames.pushBack(parameter);
   out << data.text << "\n" << data.decodingText;
 }
+
+void ponomarev::makeCompress(std::string & parameters, HuffmanCode &)
+{
+  std::string fileSource = cutType(parameters);
+  std::string fileResult = cutType(parameters);
+
+  if (fileResult.empty() || !parameters.empty())
+  {
+    throw std::logic_error("error: wrong parameters");
+  }
+
+  std::ifstream input(fileSource, std::ios_base::binary);
+  std::ofstream output(fileResult, std::ios_base::binary);
+  if (!input || !output)
+  {
+    throw std::logic_error("can't open the file");
+  }
+
+  ponomarev::compressStream(input, output);
+  ponomarev::printSuccessfullyEncodeMessage(std::cout);
+}
+
+void ponomarev::makeDecompress(std::string & parameters, HuffmanCode &)
+{
+  std::string fileSource = cutType(parameters);
+  std::string fileResult = cutType(parameters);
+
+  if (fileResult.empty() || !parameters.empty())
+  {
+    throw std::logic_error("error: wrong parameters");
+  }
+
+  std::ifstream input(fileSource, std::ios_base::binary);
+  std::ofstream output(fileResult, std::ios_base::binary);
+  if (!input || !output)
+  {
+    throw std::logic_error("can't open the file");
+  }
+
+  ponomarev::decompressStream(input, output);
+  ponomarev::printSuccessfullyWriteMessage(std::cout);
+}
+
+void ponomarev::makeBenchmark(std::string & parameters, HuffmanCode &)
+{
+  std::string fileName = cutType(parameters);
+
+  if (fileName.empty() || !parameters.empty())
+  {
+    throw std::logic_error("error: wrong parameters");
+  }
+
+  std::ifstream input(fileName, std::ios_base::binary);
+  if (!input)
+  {
+    throw std::logic_error("can't open the file");
+  }
+
+  using clock_t = std::chrono::steady_clock;
+  using seconds_t = std::chrono::duration< double >;
+  auto getSpeed = [](size_t bytes, clock_t::time_point from, clock_t::time_point to)
+  {
+    double time = std::chrono::duration_cast< seconds_t >(to - from).count();
+    return (time > 0.0) ? (bytes / time / (1024.0 * 1024.0)) : 0.0;
+  };
+
+  clock_t::time_point start = clock_t::now();
+  HuffmanCode stringData;
+  stringData.text.assign(std::istreambuf_iterator< char >(input), std::istreambuf_iterator< char >());
+  size_t size = stringData.text.size();
+  if (size == 0)
+  {
+    std::cout << "tree: alphabet 0 symbols, build 0 us\n";
+    std::cout << "string: encode 0 MB/s, decode 0 MB/s, size 0 bytes\n";
+    std::cout << "stream: encode 0 MB/s, decode 0 MB/s, size 0 bytes\n";
+    return;
+  }
+  ponomarev::calcFreq(stringData.text, stringData);
+  clock_t::time_point built = clock_t::now();
+  ponomarev::createTree(stringData);
+  seconds_t buildTime = clock_t::now() - built;
+  std::string encodedString = "";
+  for (char i : stringData.text)
+  {
+    encodedString += stringData.codes[i];
+  }
+  clock_t::time_point encoded = clock_t::now();
+  stringData.decodingText = std::move(encodedString);
+  ponomarev::decodeFile(stringData);
+  clock_t::time_point decoded = clock_t::now();
+
+  std::cout << "tree: alphabet " << stringData.freq.getSize() << " symbols, ";
+  std::cout << "build " << buildTime.count() * 1000000.0 << " us\n";
+  std::cout << "string: encode " << getSpeed(size, start, encoded) << " MB/s, ";
+  std::cout << "decode " << getSpeed(size, encoded, decoded) << " MB/s, ";
+  std::cout << "size " << stringData.decodingText.size() << " bytes\n";
+
+  input.clear();
+  input.seekg(0);
+  std::stringstream packed;
+  std::ostringstream unpacked;
+  start = clock_t::now();
+  ponomarev::compressStream(input, packed);
+  encoded = clock_t::now();
+  ponomarev::decompressStream(packed, unpacked);
+  decoded = clock_t::now();
+
+  std::cout << "stream: encode " << getSpeed(size, start, encoded) << " MB/s, ";
+  std::cout << "decode " << getSpeed(size, encoded, decoded) << " MB/s, ";
+  std::cout << "size " << packed.str().size() << " bytes\n";
+}
@@ -16,6 +16,9 @@ namespace ponomarev
   void makeClean(std::string & parameters, HuffmanCode & data);
   void makeDelete(std::string & parameters, HuffmanCode &);
   void makeSave(std::string & parameters, HuffmanCode & data);
+  void makeCompress(std::string & parameters, HuffmanCode &);
+  void makeDecompress(std::string & parameters, HuffmanCode &);
+  void makeBenchmark(std::string & parameters, HuffmanCode &);
 }
 
 #endif
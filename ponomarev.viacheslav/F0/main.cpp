@@ -1,4 +1,3 @@
-#include <limits>
 #include <functional>
 #include <iostream>
 #include "commands.hpp"
@@ -19,6 +18,9 @@ int main()
     commands["decode"] = ponomarev::makeDecode;
     commands["delete"] = ponomarev::makeDelete;
     commands["clean"] = ponomarev::makeClean;
+    commands["compress"] = ponomarev::makeCompress;
+    commands["decompress"] = ponomarev::makeDecompress;
+    commands["benchmark"] = ponomarev::makeBenchmark;
   }
 
   ponomarev::printWelcomeMessage(std::cout);
@@ -26,7 +28,7 @@ int main()
   std::string type = "";
   ponomarev::HuffmanCode data;
 
-  while (std::cin >> command)
+  while (std::getline(std::cin, command))
   {
     type = ponomarev::cutType(command);
     try
@@ -36,8 +38,6 @@ int main()
     catch (const std::logic_error &)
     {
       ponomarev::printInvalidCommandMessage(std::cout);
-      std::cin.clear();
-      std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
 
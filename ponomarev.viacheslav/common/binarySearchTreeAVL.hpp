@@ -751,10 +751,10 @@ typename BSTree< Key, Value, Compare >::Node * BSTree< Key, Value, Compare >::pu
   {
     node_->left = push(key, value, node_->left);
     node_->left->parent = node_;
-    node_->hight++;
-    if (getHight(node_->left) - getHight(node_->right) > 1)
+    node_->hight = std::max(getHight(node_->left), getHight(node_->right)) + 1;
+    if (getHight(node_->left) > getHight(node_->right) + 1)
     {
-      if (node_->right == nullptr || key < node_->left->data.first)
+      if (key < node_->left->data.first)
       {
         node_ = rightRotate(node_);
       }
@@ -768,10 +768,10 @@ typename BSTree< Key, Value, Compare >::Node * BSTree< Key, Value, Compare >::pu
   {
     node_->right = push(key, value, node_->right);
     node_->right->parent = node_;
-    node_->hight++;
-    if ((getHight(node_->right) - getHight(node_->left)) > 1)
+    node_->hight = std::max(getHight(node_->left), getHight(node_->right)) + 1;
+    if (getHight(node_->right) > getHight(node_->left) + 1)
     {
-      if (node_->left == nullptr || key > node_->right->data.first)
+      if (key > node_->right->data.first)
       {
         node_ = leftRotate(node_);
       }
@@ -957,7 +957,7 @@ template< typename Key, typename Value, typename Compare >
 typename BSTree< Key, Value, Compare >::Iterator BSTree< Key, Value, Compare >::begin() noexcept
 {
   Node * temp = root_;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
@@ -974,7 +974,7 @@ template< typename Key, typename Value, typename Compare >
 typename BSTree< Key, Value, Compare >::ConstIterator BSTree< Key, Value, Compare >::cbegin() const noexcept
 {
   Node * temp = root_;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
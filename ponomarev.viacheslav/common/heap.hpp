@@ -0,0 +1,248 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace ponomarev
+{
+  // Plain binary heap without a position index: Huffman construction only
+  // pushes and pops, so decrease-key is never needed.
+  template < typename T, typename Compare = std::less< T > >
+  class Heap {
+  public:
+    Heap();
+    explicit Heap(size_t capacity);
+    Heap(const Heap & other);
+    Heap(Heap && other) noexcept;
+    ~Heap();
+
+    Heap & operator=(const Heap & other);
+    Heap & operator=(Heap && other) noexcept;
+
+    const T & getElem() const;
+
+    bool isEmpty() const noexcept;
+    size_t getSize() const noexcept;
+
+    void reserve(size_t capacity);
+    void push(const T & value);
+    void push(T && value);
+    void pop();
+    void clear() noexcept;
+    void swap(Heap & other) noexcept;
+
+  private:
+    T * data_;
+    size_t size_;
+    size_t capacity_;
+    Compare comp_;
+
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+  };
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare >::Heap():
+  data_(nullptr),
+  size_(0),
+  capacity_(0),
+  comp_()
+{}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare >::Heap(size_t capacity):
+  Heap()
+{
+  reserve(capacity);
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare >::Heap(const Heap & other):
+  Heap()
+{
+  reserve(other.size_);
+  for (size_t i = 0; i < other.size_; i++)
+  {
+    data_[i] = other.data_[i];
+  }
+  size_ = other.size_;
+  comp_ = other.comp_;
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare >::Heap(Heap && other) noexcept:
+  data_(other.data_),
+  size_(other.size_),
+  capacity_(other.capacity_),
+  comp_(std::move(other.comp_))
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare >::~Heap()
+{
+  delete[] data_;
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare > & ponomarev::Heap< T, Compare >::operator=(const Heap & other)
+{
+  if (this != &other)
+  {
+    Heap temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+template < typename T, typename Compare >
+ponomarev::Heap< T, Compare > & ponomarev::Heap< T, Compare >::operator=(Heap && other) noexcept
+{
+  if (this != &other)
+  {
+    Heap temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+template < typename T, typename Compare >
+const T & ponomarev::Heap< T, Compare >::getElem() const
+{
+  if (isEmpty())
+  {
+    throw std::logic_error("error: heap is empty");
+  }
+  return data_[0];
+}
+
+template < typename T, typename Compare >
+bool ponomarev::Heap< T, Compare >::isEmpty() const noexcept
+{
+  return size_ == 0;
+}
+
+template < typename T, typename Compare >
+size_t ponomarev::Heap< T, Compare >::getSize() const noexcept
+{
+  return size_;
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::reserve(size_t capacity)
+{
+  if (capacity <= capacity_)
+  {
+    return;
+  }
+  T * newData = new T[capacity];
+  try
+  {
+    for (size_t i = 0; i < size_; i++)
+    {
+      newData[i] = std::move(data_[i]);
+    }
+  }
+  catch (...)
+  {
+    delete[] newData;
+    throw;
+  }
+  delete[] data_;
+  data_ = newData;
+  capacity_ = capacity;
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::push(const T & value)
+{
+  push(T(value));
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::push(T && value)
+{
+  if (size_ == capacity_)
+  {
+    reserve(capacity_ == 0 ? 16 : capacity_ * 2);
+  }
+  data_[size_] = std::move(value);
+  siftUp(size_++);
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::pop()
+{
+  if (size_ == 0)
+  {
+    return;
+  }
+  data_[0] = std::move(data_[--size_]);
+  siftDown(0);
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::clear() noexcept
+{
+  size_ = 0;
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::swap(Heap & other) noexcept
+{
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(comp_, other.comp_);
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::siftUp(size_t index)
+{
+  T value = std::move(data_[index]);
+  while (index != 0)
+  {
+    size_t parent = (index - 1) / 2;
+    if (!comp_(data_[parent], value))
+    {
+      break;
+    }
+    data_[index] = std::move(data_[parent]);
+    index = parent;
+  }
+  data_[index] = std::move(value);
+}
+
+template < typename T, typename Compare >
+void ponomarev::Heap< T, Compare >::siftDown(size_t index)
+{
+  if (size_ == 0)
+  {
+    return;
+  }
+  T value = std::move(data_[index]);
+  size_t child = 2 * index + 1;
+  while (child < size_)
+  {
+    if ((child + 1 < size_) && comp_(data_[child], data_[child + 1]))
+    {
+      child++;
+    }
+    if (!comp_(value, data_[child]))
+    {
+      break;
+    }
+    data_[index] = std::move(data_[child]);
+    index = child;
+    child = 2 * index + 1;
+  }
+  data_[index] = std::move(value);
+}
+
+#endif
@@ -0,0 +1,3 @@
+// The Makefile links only the lab's own directory and common,
+// so the S4 set commands are compiled into the benchmark from here.
+#include "../S4/execCommands.cpp"
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "avlTree.hpp"
+#include "../S4/execCommands.hpp"
+
+namespace
+{
+  using sets_t = psarev::avlTree< std::string, psarev::base_t >;
+  using command_t = std::function< void(sets_t&) >;
+
+  void makeSet(sets_t& dataSets, const std::string& setName, size_t size, int step)
+  {
+    std::vector< std::pair< int, std::string > > data;
+    data.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      data.push_back({ static_cast< int >(i) * step, "value" });
+    }
+    psarev::replaceSet(dataSets, setName, data);
+  }
+
+  double runCommand(sets_t& dataSets, const command_t& command, const std::string& args)
+  {
+    std::istringstream in(args);
+    std::streambuf* cinBuf = std::cin.rdbuf(in.rdbuf());
+    auto start = std::chrono::steady_clock::now();
+    command(dataSets);
+    std::chrono::duration< double, std::milli > time = std::chrono::steady_clock::now() - start;
+    std::cin.rdbuf(cinBuf);
+    return time.count();
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  size_t size = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  if (argc > 2 || size == 0)
+  {
+    std::cerr << "Usage: lab [size]\n";
+    return 1;
+  }
+
+  sets_t dataSets;
+  auto start = std::chrono::steady_clock::now();
+  makeSet(dataSets, "a", size, 2);
+  makeSet(dataSets, "b", size, 3);
+  std::chrono::duration< double, std::milli > buildTime = std::chrono::steady_clock::now() - start;
+  std::cout << "build a and b, " << size << " keys each: " << buildTime.count() << " ms\n";
+
+  std::pair< std::string, command_t > commands[] = {
+    { "complement", psarev::complement },
+    { "intersect", psarev::intersect },
+    { "union", psarev::unio }
+  };
+  for (auto& command : commands)
+  {
+    double time = runCommand(dataSets, command.second, command.first + " a b");
+    size_t resSize = (*dataSets.find(command.first)).second.getSize();
+    std::cout << command.first << ": " << time << " ms, " << resSize << " keys\n";
+  }
+  return 0;
+}
@@ -76,22 +76,30 @@ void psarev::complement(avlTree< std::string, avlTree< int, std::string > >& dat
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
+  std::vector< std::pair< int, std::string > > merged;
+  auto fIter = (*fSetIter).second.begin();
+  auto fEnd = (*fSetIter).second.end();
+  auto sIter = (*sSetIter).second.begin();
+  auto sEnd = (*sSetIter).second.end();
+  while (fIter != fEnd)
   {
-    auto newIter = (*dataSets.find(sSet)).second.find((*iter).first);
-    if (newIter == (*dataSets.find(sSet)).second.end())
+    if (sIter == sEnd || (*fIter).first < (*sIter).first)
     {
-      resSet.insert(*iter);
+      merged.push_back(*fIter);
+      ++fIter;
+    }
+    else if ((*sIter).first < (*fIter).first)
+    {
+      ++sIter;
+    }
+    else
+    {
+      ++fIter;
+      ++sIter;
     }
   }
 
-  auto checkIter = dataSets.find(newSet);
-  if (checkIter != dataSets.end())
-  {
-    dataSets.erase(newSet);
-  }
-  dataSets.insert({ newSet, resSet });
+  replaceSet(dataSets, newSet, merged);
 }
 
 void psarev::intersect(avlTree<std::string, psarev::avlTree<int, std::string>>& dataSets)
@@ -107,22 +115,30 @@ void psarev::intersect(avlTree<std::string, psarev::avlTree<int, std::string>>&
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
+  std::vector< std::pair< int, std::string > > merged;
+  auto fIter = (*fSetIter).second.begin();
+  auto fEnd = (*fSetIter).second.end();
+  auto sIter = (*sSetIter).second.begin();
+  auto sEnd = (*sSetIter).second.end();
+  while (fIter != fEnd && sIter != sEnd)
   {
-    auto interSSetIter = (*dataSets.find(sSet)).second.find((*iter).first);
-    if (interSSetIter != (*dataSets.find(sSet)).second.end())
+    if ((*fIter).first < (*sIter).first)
+    {
+      ++fIter;
+    }
+    else if ((*sIter).first < (*fIter).first)
     {
-      resSet.insert(*iter);
+      ++sIter;
+    }
+    else
+    {
+      merged.push_back(*fIter);
+      ++fIter;
+      ++sIter;
     }
   }
 
-  auto checkIter = dataSets.find(newSet);
-  if (checkIter != dataSets.end())
-  {
-    dataSets.erase(newSet);
-  }
-  dataSets.insert({ newSet, resSet });
+  replaceSet(dataSets, newSet, merged);
 }
 
 void psarev::unio(avlTree<std::string, avlTree<int, std::string>>& dataSets)
@@ -138,24 +154,42 @@ void psarev::unio(avlTree<std::string, avlTree<int, std::string>>& dataSets)
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
-  {
-    resSet.insert(*iter);
-  }
-  for (auto iter = (*sSetIter).second.begin(); iter != (*sSetIter).second.end(); iter++)
+  std::vector< std::pair< int, std::string > > merged;
+  auto fIter = (*fSetIter).second.begin();
+  auto fEnd = (*fSetIter).second.end();
+  auto sIter = (*sSetIter).second.begin();
+  auto sEnd = (*sSetIter).second.end();
+  while (fIter != fEnd || sIter != sEnd)
   {
-    auto setIter = resSet.find((*iter).first);
-    if (setIter == resSet.end())
+    if (sIter == sEnd || (fIter != fEnd && (*fIter).first < (*sIter).first))
+    {
+      merged.push_back(*fIter);
+      ++fIter;
+    }
+    else if (fIter == fEnd || (*sIter).first < (*fIter).first)
     {
-      resSet.insert(*iter);
+      merged.push_back(*sIter);
+      ++sIter;
+    }
+    else
+    {
+      merged.push_back(*fIter);
+      ++fIter;
+      ++sIter;
     }
   }
 
-  auto checkIter = dataSets.find(newSet);
+  replaceSet(dataSets, newSet, merged);
+}
+
+void psarev::replaceSet(avlTree< std::string, base_t >& dataSets, const std::string& setName, std::vector< std::pair< int, std::string > >& merged)
+{
+  base_t resSet(std::make_move_iterator(merged.begin()), std::make_move_iterator(merged.end()));
+
+  auto checkIter = dataSets.find(setName);
   if (checkIter != dataSets.end())
   {
-    dataSets.erase(newSet);
+    dataSets.erase(setName);
   }
-  dataSets.insert({ newSet, resSet });
+  dataSets.insert({ setName, std::move(resSet) });
 }
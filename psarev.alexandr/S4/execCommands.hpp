@@ -2,6 +2,7 @@
 #define EXEC_COMMANDS_HPP
 #include <iostream>
 #include <string>
+#include <vector>
 #include "avlTree.hpp"
 
 namespace psarev
@@ -17,6 +18,7 @@ namespace psarev
   void complement(avlTree< std::string, avlTree< int, std::string > >& dataSets);
   void intersect(avlTree< std::string, avlTree< int, std::string > >& dataSets);
   void unio(avlTree< std::string, avlTree< int, std::string > >& dataSets);
+  void replaceSet(avlTree< std::string, base_t >& dataSets, const std::string& setName, std::vector< std::pair< int, std::string > >& merged);
 }
 
 #endif
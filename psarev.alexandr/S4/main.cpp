@@ -1,4 +1,5 @@
 #include <fstream>
+#include <limits>
 #include "avlTree.hpp"
 #include "execCommands.hpp"
 
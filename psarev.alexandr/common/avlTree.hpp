@@ -24,6 +24,9 @@ namespace psarev
 
     avlTree();
     avlTree(const avlTree& that);
+    avlTree(avlTree&& that) noexcept;
+    template < typename ForwardIt >
+    avlTree(ForwardIt first, ForwardIt last);
     avlTree(size_t& initSize, dataType& initData);
     avlTree(std::initializer_list< dataType > inList);
     ~avlTree();
@@ -78,7 +81,7 @@ namespace psarev
       Unit* right;
 
       Unit(dataType data_, Unit* ancest_ = nullptr, Unit* left_ = nullptr, Unit* right_ = nullptr) :
-        data(data_),
+        data(std::move(data_)),
         ancest(ancest_),
         left(left_),
         right(right_)
@@ -88,6 +91,8 @@ namespace psarev
     Unit* treeRoot;
 
     size_t getSize(Unit* unit) const;
+    template < typename InputIt >
+    Unit* buildBal(InputIt& pos, size_t count, Unit* ancest);
     void undercut(Unit* unit);
     Unit* delUnit(Unit* unit, const Key& key);
 
@@ -672,9 +677,43 @@ template<typename Key, typename Value, typename Compare>
 psarev::avlTree< Key, Value, Compare >::avlTree(const avlTree& that) :
   treeRoot(nullptr)
 {
-  for (Iterator iter = that.cbegin(); iter != cend(); ++iter)
+  ConstIterator pos = that.cbegin();
+  treeRoot = buildBal(pos, that.getSize(), nullptr);
+}
+
+template<typename Key, typename Value, typename Compare>
+psarev::avlTree< Key, Value, Compare >::avlTree(avlTree&& that) noexcept :
+  treeRoot(that.treeRoot)
+{
+  that.treeRoot = nullptr;
+}
+
+template<typename Key, typename Value, typename Compare>
+template < typename ForwardIt >
+psarev::avlTree< Key, Value, Compare >::avlTree(ForwardIt first, ForwardIt last) :
+  treeRoot(nullptr)
+{
+  Compare compare;
+  size_t count = 0;
+  bool isSorted = true;
+  ForwardIt prev = first;
+  for (ForwardIt iter = first; iter != last; ++iter)
+  {
+    if (count != 0 && !compare((*prev).first, (*iter).first))
+    {
+      isSorted = false;
+    }
+    prev = iter;
+    ++count;
+  }
+  if (isSorted)
+  {
+    treeRoot = buildBal(first, count, nullptr);
+    return;
+  }
+  for (; first != last; ++first)
   {
-    insert(*iter);
+    insert(*first);
   }
 }
 
@@ -1145,6 +1184,43 @@ size_t psarev::avlTree<Key, Value, Compare>::getSize(Unit* unit) const
   return res;
 }
 
+template<typename Key, typename Value, typename Compare>
+template < typename InputIt >
+typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Value, Compare>::buildBal(InputIt& pos, size_t count, Unit* ancest)
+{
+  if (count == 0)
+  {
+    return nullptr;
+  }
+  size_t leftCount = count / 2;
+  Unit* left = buildBal(pos, leftCount, nullptr);
+  Unit* unit = nullptr;
+  try
+  {
+    unit = new Unit(*pos, ancest, left);
+  }
+  catch (...)
+  {
+    undercut(left);
+    throw;
+  }
+  ++pos;
+  if (left != nullptr)
+  {
+    left->ancest = unit;
+  }
+  try
+  {
+    unit->right = buildBal(pos, count - leftCount - 1, unit);
+  }
+  catch (...)
+  {
+    undercut(unit);
+    throw;
+  }
+  return unit;
+}
+
 template<typename Key, typename Value, typename Compare>
 void psarev::avlTree<Key, Value, Compare>::undercut(Unit* unit)
 {
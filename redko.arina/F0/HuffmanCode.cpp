@@ -1,6 +1,7 @@
 #include "HuffmanCode.hpp"
 #include <string>
 #include <algorithm>
+#include "decodeTable.hpp"
 #include "delimiter.hpp"
 
 redko::HuffmanCode::HuffmanCode():
@@ -55,51 +56,8 @@ void redko::HuffmanCode::encode()
 
 void redko::HuffmanCode::decode()
 {
-  root_ = new HuffmanNode();
-
-  for (auto i : charsCode_)
-  {
-    HuffmanNode * curr = root_;
-    for (auto j : i.second)
-    {
-      if (j == '0')
-      {
-        if (!curr->left)
-        {
-          curr->left = new HuffmanNode();
-        }
-        curr = curr->left;
-      }
-      else
-      {
-        if (!curr->right)
-        {
-          curr->right = new HuffmanNode();
-        }
-        curr = curr->right;
-      }
-    }
-    curr->data = i.first;
-  }
-
-  HuffmanNode * curr = root_;
-  for (auto i : encodedText_)
-  {
-    if (i == '0' && curr->left)
-    {
-      curr = curr->left;
-    }
-    else if (i == '1' && curr->right)
-    {
-      curr = curr->right;
-    }
-
-    if (!curr->left && !curr->right)
-    {
-      sourseText_ += curr->data;
-      curr = root_;
-    }
-  }
+  DecodeTable table(charsCode_);
+  sourseText_ = table.decode(encodedText_);
 }
 
 void redko::HuffmanCode::countFreq()
@@ -141,12 +99,13 @@ void redko::HuffmanCode::makeCodeTree()
 {
   redko::List< HuffmanNode * > nodes;
   HuffmanNode * tmp = nullptr;
+  auto byFreq = [](const HuffmanNode * lhs, const HuffmanNode * rhs){ return lhs->freq < rhs->freq; };
   for (auto i : charsFreq_)
   {
     tmp = new HuffmanNode(i.second, i.first);
     nodes.pushBack(tmp);
   }
-  nodes.sort();
+  nodes.sort(byFreq);
   if (std::distance(nodes.begin(), nodes.end()) == 1)
   {
     tmp = nodes.front();
@@ -162,7 +121,7 @@ void redko::HuffmanCode::makeCodeTree()
       nodes.popFront();
       tmp = new HuffmanNode(left->freq + right->freq, '0', left, right);
       nodes.pushBack(tmp);
-      nodes.sort();
+      nodes.sort(byFreq);
     }
     root_ = nodes.front();
   }
@@ -0,0 +1,149 @@
+#include "decodeTable.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+constexpr size_t redko::DecodeTable::maxTableBits;
+
+redko::DecodeTable::DecodeTable(const BSTree< char, std::string > & codes):
+  entries_(),
+  rootBits_(0),
+  minLength_(0)
+{
+  std::vector< Code > all;
+  for (auto it = codes.cbegin(); it != codes.cend(); ++it)
+  {
+    if (it->second.empty())
+    {
+      throw std::logic_error("Empty code in the alphabet encoding");
+    }
+    all.push_back({ &it->second, it->first });
+    if (minLength_ == 0 || it->second.size() < minLength_)
+    {
+      minLength_ = it->second.size();
+    }
+  }
+  if (!all.empty())
+  {
+    rootBits_ = build(all, 0);
+  }
+}
+
+std::string redko::DecodeTable::decode(const std::string & bits) const
+{
+  std::string result;
+  if (entries_.empty())
+  {
+    return result;
+  }
+  result.resize(bits.size() / minLength_);
+
+  size_t count = 0;
+  size_t pos = 0;
+  const size_t size = bits.size();
+  while (pos < size)
+  {
+    size_t offset = 0;
+    size_t tableBits = rootBits_;
+    size_t curr = pos;
+    while (true)
+    {
+      const Entry & entry = entries_[offset + peek(bits, curr, tableBits)];
+      if (entry.length == 0 || curr + entry.length > size)
+      {
+        if (curr + tableBits > size)
+        {
+          result.resize(count);
+          return result;
+        }
+        throw std::logic_error("Encoded text does not match the alphabet encoding");
+      }
+      curr += entry.length;
+      if (entry.nextBits == 0)
+      {
+        result[count++] = entry.symbol;
+        break;
+      }
+      offset = entry.next;
+      tableBits = entry.nextBits;
+    }
+    pos = curr;
+  }
+  result.resize(count);
+  return result;
+}
+
+size_t redko::DecodeTable::build(std::vector< Code > & codes, size_t depth)
+{
+  size_t maxLength = 0;
+  for (const auto & i : codes)
+  {
+    maxLength = std::max(maxLength, i.bits->size() - depth);
+  }
+  const size_t bits = std::min(maxLength, maxTableBits);
+  const size_t offset = entries_.size();
+  entries_.resize(offset + (size_t(1) << bits), Entry{ '\0', 0, 0, 0 });
+
+  std::vector< std::pair< size_t, Code > > longCodes;
+  for (const auto & i : codes)
+  {
+    const size_t length = i.bits->size() - depth;
+    const size_t index = peek(*i.bits, depth, bits);
+    if (length > bits)
+    {
+      longCodes.push_back({ index, i });
+      continue;
+    }
+    const size_t first = index & ~((size_t(1) << (bits - length)) - 1);
+    const size_t last = first + (size_t(1) << (bits - length));
+    for (size_t j = first; j < last; ++j)
+    {
+      if (entries_[offset + j].length != 0)
+      {
+        throw std::logic_error("Alphabet encoding is not a prefix code");
+      }
+      entries_[offset + j] = Entry{ i.symbol, static_cast< unsigned char >(length), 0, 0 };
+    }
+  }
+
+  std::sort(longCodes.begin(), longCodes.end(),
+    [](const std::pair< size_t, Code > & lhs, const std::pair< size_t, Code > & rhs)
+    {
+      return lhs.first < rhs.first;
+    });
+  auto groupBegin = longCodes.begin();
+  while (groupBegin != longCodes.end())
+  {
+    const size_t index = groupBegin->first;
+    auto groupEnd = groupBegin;
+    std::vector< Code > group;
+    while (groupEnd != longCodes.end() && groupEnd->first == index)
+    {
+      group.push_back(groupEnd->second);
+      ++groupEnd;
+    }
+    if (entries_[offset + index].length != 0)
+    {
+      throw std::logic_error("Alphabet encoding is not a prefix code");
+    }
+    const size_t next = entries_.size();
+    const size_t nextBits = build(group, depth + bits);
+    entries_[offset + index] = Entry{ '\0', static_cast< unsigned char >(bits), static_cast< unsigned char >(nextBits), next };
+    groupBegin = groupEnd;
+  }
+  return bits;
+}
+
+size_t redko::DecodeTable::peek(const std::string & bits, size_t pos, size_t count) const
+{
+  size_t value = 0;
+  const size_t size = bits.size();
+  for (size_t i = 0; i < count; ++i)
+  {
+    value <<= 1;
+    if (pos + i < size && bits[pos + i] == '1')
+    {
+      value |= 1;
+    }
+  }
+  return value;
+}
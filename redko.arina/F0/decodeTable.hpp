@@ -0,0 +1,42 @@
+#ifndef DECODETABLE_HPP
+#define DECODETABLE_HPP
+#include <string>
+#include <vector>
+#include "binarySearchTree.hpp"
+
+namespace redko
+{
+  class DecodeTable
+  {
+  public:
+    explicit DecodeTable(const BSTree< char, std::string > & codes);
+
+    std::string decode(const std::string & bits) const;
+
+  private:
+    struct Entry
+    {
+      char symbol;
+      unsigned char length;
+      unsigned char nextBits;
+      size_t next;
+    };
+
+    struct Code
+    {
+      const std::string * bits;
+      char symbol;
+    };
+
+    static constexpr size_t maxTableBits = 10;
+
+    size_t build(std::vector< Code > & codes, size_t depth);
+    size_t peek(const std::string & bits, size_t pos, size_t count) const;
+
+    std::vector< Entry > entries_;
+    size_t rootBits_;
+    size_t minLength_;
+  };
+}
+
+#endif
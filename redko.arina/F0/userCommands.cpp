@@ -131,7 +131,15 @@ void redko::decode(const std::string & descr)
     }
   }
 
-  obj.decode();
+  try
+  {
+    obj.decode();
+  }
+  catch (const std::logic_error &)
+  {
+    printInvalidFormat(std::cout);
+    return;
+  }
 
   std::cout << "<succesfully decoded>\n";
 
@@ -173,7 +181,15 @@ void redko::recode(const std::string & descr)
     printInvalidFormat(std::cout);
     return;
   }
-  firstObj.decode();
+  try
+  {
+    firstObj.decode();
+  }
+  catch (const std::logic_error &)
+  {
+    printInvalidFormat(std::cout);
+    return;
+  }
 
   HuffmanCode secondObj;
   if (!(secondInput >> secondObj) && !secondInput.eof())
@@ -183,7 +199,15 @@ void redko::recode(const std::string & descr)
     printInvalidFormat(std::cout);
     return;
   }
-  secondObj.decode();
+  try
+  {
+    secondObj.decode();
+  }
+  catch (const std::logic_error &)
+  {
+    printInvalidFormat(std::cout);
+    return;
+  }
 
   std::string united = firstObj.getDecoded() + secondObj.getDecoded();
   HuffmanCode result(united);
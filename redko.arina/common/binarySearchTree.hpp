@@ -925,7 +925,7 @@ template < typename Key, typename Value, typename Compare >
 typename redko::BSTree< Key, Value, Compare >::const_iterator redko::BSTree< Key, Value, Compare >::cbegin() const noexcept
 {
   Node * curr = root_;
-  while (curr != nullptr)
+  while (curr != nullptr && curr->left != nullptr)
   {
     curr = curr->left;
   }
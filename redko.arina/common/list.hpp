@@ -5,6 +5,7 @@
 #include <memory>
 #include <cassert>
 #include <iterator>
+#include <functional>
 
 namespace redko
 {
@@ -65,6 +66,10 @@ namespace redko
 
     void merge(List & other);
     void merge(List && other);
+    template< typename Compare >
+    void merge(List & other, Compare comp);
+    template< typename Compare >
+    void merge(List && other, Compare comp);
     void spliceAfter(iterator pos, List & other);
     void spliceAfter(iterator pos, List && other);
     size_t remove(const T & value);
@@ -72,7 +77,11 @@ namespace redko
     size_t removeIf(UnaryPredicate pred);
     void reverse() noexcept;
     size_t unique();
+    template< typename BinaryPredicate >
+    size_t unique(BinaryPredicate pred);
     void sort();
+    template< typename Compare >
+    void sort(Compare comp);
 
     bool operator==(const List & rhs);
     bool operator!=(const List & rhs);
@@ -96,6 +105,10 @@ namespace redko
       ListElem * next;
     };
     ListElem head_;
+
+    static ListElem * cut(ListElem * first, size_t count) noexcept;
+    template< typename Compare >
+    static void mergeAfter(ListElem *& tail, ListElem * first, ListElem * second, Compare comp);
   };
 }
 
@@ -545,98 +558,33 @@ void redko::List< T >::swap(List & other) noexcept
 template< typename T >
 void redko::List< T >::merge(List & other)
 {
-  if (&other != this)
-  {
-    ListElem * thisElem = head_.next;
-    if (thisElem != nullptr)
-    {
-      while (other.head_.next != nullptr)
-      {
-        if (thisElem->next != nullptr)
-        {
-          if (other.head_.next->data >= thisElem->data && other.head_.next->data < thisElem->next->data)
-          {
-            ListElem * tmp = thisElem->next;
-            thisElem->next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            thisElem->next->next = tmp;
-          }
-          thisElem = thisElem->next;
-        }
-        else
-        {
-          if (other.head_.next->data >= thisElem->data)
-          {
-            thisElem->next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            thisElem->next->next = nullptr;
-            thisElem = thisElem->next;
-          }
-          else
-          {
-            ListElem * tmp = head_.next;
-            head_.next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            head_.next->next = tmp;
-            thisElem = head_.next;
-          }
-        }
-      }
-    }
-    else
-    {
-      *this = other;
-    }
-  }
+  merge(other, std::less< T >());
 }
 template< typename T >
 void redko::List< T >::merge(List && other)
+{
+  merge(other, std::less< T >());
+}
+template< typename T >
+template< typename Compare >
+void redko::List< T >::merge(List & other, Compare comp)
 {
   if (&other != this)
   {
-    ListElem * thisElem = head_.next;
-    if (thisElem != nullptr)
-    {
-      while (other.head_.next != nullptr)
-      {
-        if (thisElem->next != nullptr)
-        {
-          if (other.head_.next->data >= thisElem->data && other.head_.next->data < thisElem->next->data)
-          {
-            ListElem * tmp = thisElem->next;
-            thisElem->next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            thisElem->next->next = tmp;
-          }
-          thisElem = thisElem->next;
-        }
-        else
-        {
-          if (other.head_.next->data >= thisElem->data)
-          {
-            thisElem->next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            thisElem->next->next = nullptr;
-            thisElem = thisElem->next;
-          }
-          else
-          {
-            ListElem * tmp = head_.next;
-            head_.next = other.head_.next;
-            other.head_.next = other.head_.next->next;
-            head_.next->next = tmp;
-            thisElem = head_.next;
-          }
-        }
-      }
-    }
-    else
-    {
-      *this = other;
-    }
+    ListElem * first = head_.next;
+    ListElem * second = other.head_.next;
+    other.head_.next = nullptr;
+    ListElem * tail = &head_;
+    mergeAfter(tail, first, second, comp);
   }
 }
 template< typename T >
+template< typename Compare >
+void redko::List< T >::merge(List && other, Compare comp)
+{
+  merge(other, comp);
+}
+template< typename T >
 void redko::List< T >::spliceAfter(iterator pos, List & other)
 {
   if (!other.isEmpty())
@@ -733,25 +681,27 @@ void redko::List< T >::reverse() noexcept
 }
 template< typename T >
 size_t redko::List< T >::unique()
+{
+  return unique(std::equal_to< T >());
+}
+template< typename T >
+template< typename BinaryPredicate >
+size_t redko::List< T >::unique(BinaryPredicate pred)
 {
   size_t res = 0;
-  if (!isEmpty() && head_.next->next != nullptr)
+  ListElem * currElem = head_.next;
+  while (currElem != nullptr && currElem->next != nullptr)
   {
-    iterator nextElem(head_.next->next);
-    iterator currElem(head_.next);
-    while (nextElem != end())
+    if (pred(currElem->data, currElem->next->data))
     {
-      if (*currElem == *nextElem)
-      {
-        res++;
-        nextElem = eraseAfter((currElem));
-        nextElem++;
-      }
-      else
-      {
-        currElem++;
-        nextElem++;
-      }
+      ListElem * duplicate = currElem->next;
+      currElem->next = duplicate->next;
+      delete duplicate;
+      res++;
+    }
+    else
+    {
+      currElem = currElem->next;
     }
   }
   return res;
@@ -759,31 +709,69 @@ size_t redko::List< T >::unique()
 template< typename T >
 void redko::List< T >::sort()
 {
-  if (!isEmpty())
+  sort(std::less< T >());
+}
+template< typename T >
+template< typename Compare >
+void redko::List< T >::sort(Compare comp)
+{
+  size_t size = 0;
+  for (ListElem * currElem = head_.next; currElem != nullptr; currElem = currElem->next)
   {
-    ListElem * currElem = nullptr;
-    ListElem * nextElem = nullptr;
-    bool wasEdited = true;
-    while (wasEdited)
+    size++;
+  }
+  for (size_t width = 1; width < size; width *= 2)
+  {
+    ListElem * tail = &head_;
+    ListElem * rest = head_.next;
+    while (rest != nullptr)
     {
-      wasEdited = false;
-      currElem = head_.next;
-      nextElem = head_.next->next;
-      while (nextElem != nullptr)
-      {
-        if (currElem->data > nextElem->data)
-        {
-          wasEdited = true;
-          T tmp = currElem->data;
-          currElem->data = nextElem->data;
-          nextElem->data = tmp;
-        }
-        currElem = nextElem;
-        nextElem = nextElem->next;
-      }
+      ListElem * first = rest;
+      ListElem * second = cut(first, width);
+      rest = cut(second, width);
+      mergeAfter(tail, first, second, comp);
     }
   }
 }
+template< typename T >
+typename redko::List< T >::ListElem * redko::List< T >::cut(ListElem * first, size_t count) noexcept
+{
+  for (size_t i = 1; first != nullptr && i < count; i++)
+  {
+    first = first->next;
+  }
+  if (first == nullptr)
+  {
+    return nullptr;
+  }
+  ListElem * rest = first->next;
+  first->next = nullptr;
+  return rest;
+}
+template< typename T >
+template< typename Compare >
+void redko::List< T >::mergeAfter(ListElem *& tail, ListElem * first, ListElem * second, Compare comp)
+{
+  while (first != nullptr && second != nullptr)
+  {
+    if (comp(second->data, first->data))
+    {
+      tail->next = second;
+      second = second->next;
+    }
+    else
+    {
+      tail->next = first;
+      first = first->next;
+    }
+    tail = tail->next;
+  }
+  tail->next = (first != nullptr) ? first : second;
+  while (tail->next != nullptr)
+  {
+    tail = tail->next;
+  }
+}
 
 template< typename T >
 bool redko::List< T >::operator==(const List & rhs)
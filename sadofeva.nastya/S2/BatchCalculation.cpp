@@ -0,0 +1,163 @@
+#include "BatchCalculation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "ExpressionCalculation.hpp"
+
+namespace
+{
+  bool isSpace(char c)
+  {
+    return std::isspace(static_cast<unsigned char>(c));
+  }
+
+  bool isOperator(char c)
+  {
+    return c == '(' || c == ')' || c == '+' || c == '-' || c == '*' || c == '/' || c == '%';
+  }
+
+  size_t findBoundary(const std::string & text, size_t from)
+  {
+    size_t i = std::min(from, text.size());
+    while (i < text.size() && (text[i] != '\n' || isSpace(text[i - 1])))
+    {
+      ++i;
+    }
+    while (i < text.size() && isSpace(text[i]))
+    {
+      ++i;
+    }
+    return i;
+  }
+
+  bool hasBadOperator(const std::string & text, size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      bool single = !isSpace(text[i]) && (i == begin || isSpace(text[i - 1])) && (i + 1 == end || isSpace(text[i + 1]));
+      if (single && !std::isdigit(static_cast<unsigned char>(text[i])) && !isOperator(text[i]))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void lowerTo(std::atomic<size_t> & value, size_t candidate)
+  {
+    size_t current = value.load();
+    while (candidate < current && !value.compare_exchange_weak(current, candidate))
+    {}
+  }
+
+  sadofeva::Queue<sadofeva::InfixExpression> readBatch(const std::string & text, const sadofeva::CalculationBatch & batch)
+  {
+    std::istringstream in(text.substr(batch.begin, batch.end - batch.begin));
+    return sadofeva::readExpressions(in);
+  }
+
+  void calculateBatch(sadofeva::Queue<sadofeva::InfixExpression> & expressions, sadofeva::CalculationBatch & batch)
+  {
+    while (!expressions.empty())
+    {
+      sadofeva::PostfixExpression postfix_expression_next(expressions.next());
+      expressions.drop();
+      try
+      {
+        batch.answers.push(sadofeva::calculatePostfixExpression(postfix_expression_next));
+      }
+      catch (const std::exception & e)
+      {
+        batch.calculationFailed = true;
+        batch.error = e.what();
+        return;
+      }
+    }
+  }
+}
+
+sadofeva::CalculationBatch::CalculationBatch(size_t begin, size_t end):
+  begin{ begin },
+  end{ end },
+  answers{},
+  readFailed{ false },
+  calculationFailed{ false },
+  error{}
+{}
+
+std::deque<sadofeva::CalculationBatch> sadofeva::splitBatches(const std::string & text, size_t batchSize)
+{
+  std::deque<CalculationBatch> batches;
+  size_t begin = 0;
+  while (begin < text.size())
+  {
+    size_t end = findBoundary(text, begin + batchSize);
+    batches.emplace_back(begin, end);
+    begin = end;
+  }
+  return batches;
+}
+
+void sadofeva::calculateBatches(const std::string & text, std::deque<CalculationBatch> & batches, size_t threads)
+{
+  std::atomic<size_t> next{ 0 };
+  std::atomic<size_t> firstReadFailed{ batches.size() };
+  std::atomic<size_t> firstCalculationFailed{ batches.size() };
+  auto work = [&]()
+  {
+    for (size_t i = next++; i < batches.size(); i = next++)
+    {
+      if (i > firstReadFailed.load())
+      {
+        continue;
+      }
+      CalculationBatch & batch = batches[i];
+      Queue<InfixExpression> expressions;
+      try
+      {
+        batch.readFailed = hasBadOperator(text, batch.begin, batch.end);
+        if (!batch.readFailed)
+        {
+          expressions = readBatch(text, batch);
+        }
+      }
+      catch (const std::exception &)
+      {
+        batch.readFailed = true;
+      }
+      if (batch.readFailed)
+      {
+        lowerTo(firstReadFailed, i);
+        continue;
+      }
+      if (i > firstCalculationFailed.load())
+      {
+        continue;
+      }
+      calculateBatch(expressions, batch);
+      if (batch.calculationFailed)
+      {
+        lowerTo(firstCalculationFailed, i);
+      }
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (size_t i = 1; i < threads && i < batches.size(); ++i)
+  {
+    pool.emplace_back(work);
+  }
+  work();
+  for (std::thread & worker : pool)
+  {
+    worker.join();
+  }
+}
+
+void sadofeva::replayReading(const std::string & text, const CalculationBatch & batch)
+{
+  readBatch(text, batch);
+}
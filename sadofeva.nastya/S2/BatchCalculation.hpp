@@ -0,0 +1,27 @@
+#ifndef BATCH_CALCULATION_HPP
+#define BATCH_CALCULATION_HPP
+#include <cstddef>
+#include <deque>
+#include <string>
+#include "stack.hpp"
+
+namespace sadofeva
+{
+  struct CalculationBatch
+  {
+    CalculationBatch(size_t begin, size_t end);
+
+    size_t begin;
+    size_t end;
+    Stack<long long> answers;
+    bool readFailed;
+    bool calculationFailed;
+    std::string error;
+  };
+
+  std::deque<CalculationBatch> splitBatches(const std::string & text, size_t batchSize);
+  void calculateBatches(const std::string & text, std::deque<CalculationBatch> & batches, size_t threads);
+  void replayReading(const std::string & text, const CalculationBatch & batch);
+}
+
+#endif
@@ -61,6 +61,10 @@ namespace
   }
   long long calcRemainderOfDivision(long long a, long long b)
   {
+    if (b == 0)
+    {
+      throw std::logic_error("division by zero");
+    }
     if (a < 0)
     {
       return a + b * (std::abs(a) / b + 1);
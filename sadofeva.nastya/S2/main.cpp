@@ -1,12 +1,30 @@
+#include <cctype>
 #include <iostream>
 #include <string>
 #include <fstream>
-#include "stack.hpp"
-#include "ExpressionCalculation.hpp"
+#include <sstream>
+#include <thread>
+#include <deque>
+#include "BatchCalculation.hpp"
+
+namespace
+{
+  std::string readText(std::istream & in)
+  {
+    std::ostringstream text;
+    if (in.peek() != std::char_traits<char>::eof())
+    {
+      text << in.rdbuf();
+    }
+    return text.str();
+  }
+}
 
 int main(int argc, char ** argv)
 {
-  sadofeva::Queue<sadofeva::InfixExpression> expressions;
+  const size_t batchSize = 1 << 20;
+  std::string text;
+  bool fromStdin = false;
 
   if (argc == 2)
   {
@@ -17,36 +35,13 @@ int main(int argc, char ** argv)
       std::cerr << "Bad file or filename\n";
       return 1;
     }
-
-    try
-    {
-      expressions = sadofeva::readExpressions(fin);
-    }
-    catch (const std::exception & e)
-    {
-      fin.close();
-      std::cerr << e.what() << '\n';
-      return 2;
-    }
+    text = readText(fin);
     fin.close();
   }
   else if (argc == 1)
   {
-    try
-    {
-      expressions = sadofeva::readExpressions(std::cin);
-    }
-    catch (const std::exception & e)
-    {
-      std::cerr << e.what() << '\n';
-      return 2;
-    }
-
-    if (std::cin.fail())
-    {
-      std::cerr << "Incorrect input\n";
-      return 1;
-    }
+    text = readText(std::cin);
+    fromStdin = true;
   }
   else
   {
@@ -54,16 +49,16 @@ int main(int argc, char ** argv)
     return 1;
   }
 
-  if (!expressions.empty())
+  std::deque<sadofeva::CalculationBatch> batches = sadofeva::splitBatches(text, batchSize);
+  size_t threads = std::thread::hardware_concurrency();
+  sadofeva::calculateBatches(text, batches, threads == 0 ? 1 : threads);
+  for (const sadofeva::CalculationBatch & batch : batches)
   {
-    sadofeva::Stack<long long> answers;
-    while (!expressions.empty())
+    if (batch.readFailed)
     {
-      sadofeva::PostfixExpression postfix_expression_next(expressions.next());
-      expressions.drop();
       try
       {
-        answers.push(sadofeva::calculatePostfixExpression(postfix_expression_next));
+        sadofeva::replayReading(text, batch);
       }
       catch (const std::exception & e)
       {
@@ -71,15 +66,33 @@ int main(int argc, char ** argv)
         return 2;
       }
     }
+  }
+  if (fromStdin && (text.empty() || !std::isspace(static_cast<unsigned char>(text.back()))))
+  {
+    std::cerr << "Incorrect input\n";
+    return 1;
+  }
+  for (const sadofeva::CalculationBatch & batch : batches)
+  {
+    if (batch.calculationFailed)
+    {
+      std::cerr << batch.error << '\n';
+      return 2;
+    }
+  }
 
-    while (!answers.empty())
+  bool first = true;
+  for (auto batch = batches.rbegin(); batch != batches.rend(); ++batch)
+  {
+    while (!batch->answers.empty())
     {
-      std::cout << answers.top();
-      answers.drop();
-      if (!answers.empty())
+      if (!first)
       {
         std::cout << ' ';
       }
+      std::cout << batch->answers.top();
+      batch->answers.drop();
+      first = false;
     }
   }
   std::cout << '\n';
@@ -11,6 +11,9 @@ namespace sadofeva
    public:
     using Iter = typename detail::BinSTree<Key, Value, Compare>::TreeIt;
     using ConstIter = typename detail::BinSTree<Key, Value, Compare>::CTreeIt;
+    AVLTree() = default;
+    template <typename ForwardIt>
+    AVLTree(ForwardIt, ForwardIt);
     Iter insert(const Key &, const Value &);
     template <typename... Args>
     Iter emplace(const Key &, Args &&...);
@@ -20,6 +23,7 @@ namespace sadofeva
     bool isEmpty() const noexcept;
     Iter find(const Key &);
     ConstIter cfind(const Key &) const;
+    bool contains(const Key &) const;
     Iter begin();
     ConstIter begin() const;
     ConstIter cbegin() const;
@@ -52,6 +56,30 @@ namespace sadofeva
   };
 }
 
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt>
+sadofeva::AVLTree<Key, Value, Compare>::AVLTree(ForwardIt first, ForwardIt last)
+{
+  Compare cmp;
+  size_t count = 0;
+  bool sorted = true;
+  for (auto it = first, prev = first; it != last; prev = it++)
+  {
+    if (count++ != 0 && !cmp(prev->first, it->first))
+    {
+      sorted = false;
+    }
+  }
+  if (sorted)
+  {
+    tree_.buildSorted(first, count);
+    return;
+  }
+  for (; first != last; ++first)
+  {
+    insert(first->first, first->second);
+  }
+}
 template <typename Key, typename Value, typename Compare>
 typename sadofeva::AVLTree<Key, Value, Compare>::Iter sadofeva::AVLTree<Key, Value, Compare>::insert(const Key & k,
  const Value & v)
@@ -180,6 +208,11 @@ typename sadofeva::AVLTree<Key, Value, Compare>::ConstIter sadofeva::AVLTree<Key
   return tree_.constItFind(k);
 }
 template <typename Key, typename Value, typename Compare>
+bool sadofeva::AVLTree<Key, Value, Compare>::contains(const Key & k) const
+{
+  return tree_.contains(k);
+}
+template <typename Key, typename Value, typename Compare>
 typename sadofeva::AVLTree<Key, Value, Compare>::Iter sadofeva::AVLTree<Key, Value, Compare>::begin()
 {
   return tree_.begin();
@@ -55,6 +55,9 @@ namespace sadofeva
       const node_t<Key, Value> * cfindMax(const node_t<Key, Value> *) const;
       CTreeIt constItFind(const Key &) const;
       TreeIt itFind(const Key &);
+      bool contains(const Key &) const;
+      template <typename InputIt>
+      void buildSorted(InputIt, size_t);
       node_t<Key, Value> * findMin(node_t<Key, Value> *);
       node_t<Key, Value> * findMax(node_t<Key, Value> *);
       int getNodeHeight(const node_t<Key, Value> *) const;
@@ -84,6 +87,8 @@ namespace sadofeva
       node_t<Key, Value> * eraseIfOnlyRightChild(node_t<Key, Value> *);
       node_t<Key, Value> * eraseIfTwoChildren(node_t<Key, Value> *);
       node_t<Key, Value> * copy(const node_t<Key, Value> *);
+      template <typename InputIt>
+      node_t<Key, Value> * buildBalanced(InputIt &, size_t);
       const node_t<Key, Value> * cfind(const Key &) const;
       node_t<Key, Value> * find(const Key &);
       void free(node_t<Key, Value> *);
@@ -438,6 +443,19 @@ namespace sadofeva
       return TreeIt(CTreeIt(cfind(k)));
     }
     template <typename Key, typename Value, typename Compare>
+    bool BinSTree<Key, Value, Compare>::contains(const Key & k) const
+    {
+      return cfind(k) != nullptr;
+    }
+    template <typename Key, typename Value, typename Compare>
+    template <typename InputIt>
+    void BinSTree<Key, Value, Compare>::buildSorted(InputIt first, size_t count)
+    {
+      auto newRoot = buildBalanced(first, count);
+      clear();
+      root_ = newRoot;
+    }
+    template <typename Key, typename Value, typename Compare>
     const node_t<Key, Value> * BinSTree<Key, Value, Compare>::cfindMin(const node_t<Key, Value> * subTree) const
     {
       if (!subTree)
@@ -873,6 +891,46 @@ namespace sadofeva
       }
       return newRoot;
     }
+    template <typename Key, typename Value, typename Compare>
+    template <typename InputIt>
+    node_t<Key, Value> * BinSTree<Key, Value, Compare>::buildBalanced(InputIt & pos, size_t count)
+    {
+      if (count == 0)
+      {
+        return nullptr;
+      }
+      auto left = buildBalanced(pos, count / 2);
+      node_t<Key, Value> * newRoot = nullptr;
+      try
+      {
+        newRoot = new node_t<Key, Value>{ *pos };
+      }
+      catch (...)
+      {
+        free(left);
+        throw;
+      }
+      ++pos;
+      newRoot->left_ = left;
+      if (left)
+      {
+        left->parent_ = newRoot;
+      }
+      try
+      {
+        newRoot->right_ = buildBalanced(pos, count - count / 2 - 1);
+      }
+      catch (...)
+      {
+        free(newRoot);
+        throw;
+      }
+      if (newRoot->right_)
+      {
+        newRoot->right_->parent_ = newRoot;
+      }
+      return newRoot;
+    }
     template <typename Key, typename Value, typename Compare = std::less<Key>>
     const node_t<Key, Value> * getNextNode(const node_t<Key, Value> * node)
     {
@@ -1,5 +1,7 @@
 #include "Command.hpp"
 #include <iostream>
+#include <iterator>
+#include <vector>
 
 void sadofeva::handleComplement(std::map<std::string, sadofeva::AVLTree<int, std::string>> & dicts,
  const std::string & newDataset,
@@ -14,20 +16,28 @@ void sadofeva::handleComplement(std::map<std::string, sadofeva::AVLTree<int, std
   }
   auto it1 = dicts.find(dataset1);
   auto it2 = dicts.find(dataset2);
-  sadofeva::AVLTree<int, std::string> result;
-
-  for (auto it = it1->second.begin(); it != it1->second.end(); ++it)
+  std::vector<std::pair<int, std::string>> merged;
+  auto first = it1->second.cbegin();
+  auto second = it2->second.cbegin();
+  while (first != it1->second.cend())
   {
-    int key = it->first;
-    try
+    if (second == it2->second.cend() || first->first < second->first)
+    {
+      merged.push_back(*first);
+      ++first;
+    }
+    else if (second->first < first->first)
     {
-      it2->second.at(key);
+      ++second;
     }
-    catch (const std::out_of_range &)
+    else
     {
-      result.insert(key, it->second);
+      ++first;
+      ++second;
     }
   }
+  sadofeva::AVLTree<int, std::string> result(std::make_move_iterator(merged.begin()),
+   std::make_move_iterator(merged.end()));
   dicts[newDataset] = std::move(result);
 }
 
@@ -44,21 +54,28 @@ void sadofeva::handleIntersect(std::map<std::string, sadofeva::AVLTree<int, std:
   }
   auto it1 = dicts.find(dataset1);
   auto it2 = dicts.find(dataset2);
-  sadofeva::AVLTree<int, std::string> result;
-  for (auto it = it1->second.begin(); it != it1->second.end(); ++it)
+  std::vector<std::pair<int, std::string>> merged;
+  auto first = it1->second.cbegin();
+  auto second = it2->second.cbegin();
+  while (first != it1->second.cend() && second != it2->second.cend())
   {
-    int key = it->first;
-    try
+    if (first->first < second->first)
+    {
+      ++first;
+    }
+    else if (second->first < first->first)
     {
-      std::string value = (it2->second.at(key))->second;
-      result.insert(key, it->second);
+      ++second;
     }
-    catch (const std::out_of_range &)
+    else
     {
-      continue;
+      merged.push_back(*first);
+      ++first;
+      ++second;
     }
   }
-
+  sadofeva::AVLTree<int, std::string> result(std::make_move_iterator(merged.begin()),
+   std::make_move_iterator(merged.end()));
   dicts[newDataset] = std::move(result);
 }
 
@@ -75,24 +92,28 @@ void sadofeva::handleUnion(std::map<std::string, sadofeva::AVLTree<int, std::str
   }
   auto it1 = dicts.find(dataset1);
   auto it2 = dicts.find(dataset2);
-  sadofeva::AVLTree<int, std::string> result;
-  for (auto it = it1->second.begin(); it != it1->second.end(); ++it)
+  std::vector<std::pair<int, std::string>> merged;
+  auto first = it1->second.cbegin();
+  auto second = it2->second.cbegin();
+  while (first != it1->second.cend() || second != it2->second.cend())
   {
-    result.insert(it->first, it->second);
-  }
-
-  for (auto it = it2->second.begin(); it != it2->second.end(); ++it)
-  {
-    try
+    if (second == it2->second.cend() || (first != it1->second.cend() && !(second->first < first->first)))
     {
-      result.at(it->first);
+      if (second != it2->second.cend() && !(first->first < second->first))
+      {
+        ++second;
+      }
+      merged.push_back(*first);
+      ++first;
     }
-    catch (const std::out_of_range &)
+    else
     {
-      result.insert(it->first, it->second);
+      merged.push_back(*second);
+      ++second;
     }
   }
-
+  sadofeva::AVLTree<int, std::string> result(std::make_move_iterator(merged.begin()),
+   std::make_move_iterator(merged.end()));
   dicts[newDataset] = std::move(result);
 }
 
@@ -2,6 +2,7 @@
 #define MYLIST_HPP
 
 #include <iostream>
+#include <utility>
 
 namespace sobolevsky
 {
@@ -22,6 +23,7 @@ namespace sobolevsky
     void popFront();
     void popBack();
     void clear();
+    void swap(List &other) noexcept;
     void remove(T val);
     void erase(Iterator position);
     void assign(size_t n, const T & val);
@@ -59,6 +61,7 @@ sobolevsky::List< T >::List()
 {
   head = nullptr;
   tail = nullptr;
+  size_ = 0;
 }
 
 template< typename T >
@@ -67,6 +70,7 @@ sobolevsky::List< T >::List(const T &val)
   Node *ptr = new Node(val);
   head = ptr;
   tail = ptr;
+  size_ = 1;
 }
 
 template< typename T >
@@ -164,6 +168,14 @@ void sobolevsky::List< T >::clear()
   }
 }
 
+template< typename T >
+void sobolevsky::List< T >::swap(List &other) noexcept
+{
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size_, other.size_);
+}
+
 template< typename T >
 void sobolevsky::List< T >::remove(T val)
 {
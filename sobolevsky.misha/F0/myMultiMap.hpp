@@ -44,13 +44,15 @@ namespace sobolevsky
   private:
     class Node;
 
-    Node *push(const Key &key, const Value &value, Node *node_);
+    Node *push(const Key &key, const Value &value, Node *node_, Node *&target);
     Node *RightRotate(Node *node_);
     Node *LeftRotate(Node *node_);
     Node *LeftRightRotate(Node *node_);
     Node *RightLeftRotate(Node *node_);
     Node *delet(const Key &key, Node *node_);
+    Node *balance(Node *node_);
     size_t height(Node *node_);
+    Node *findNode(const Key &key) const;
     void recurionDeleteAll(Node *node);
 
     Node *root;
@@ -117,84 +119,65 @@ bool sobolevsky::MyMultiMap< Key, Value >::empty()
 template< typename Key, typename Value >
 typename sobolevsky::List< Value > &sobolevsky::MyMultiMap< Key, Value >::operator[](const Key &key)
 {
-  Iterator iter(find(key));
-  if (iter == end())
+  Node *target = findNode(key);
+  if (target == nullptr)
   {
-    insert(std::pair< Key, Value>(key, Value()));
-    iter = find(key);
+    root = push(key, Value(), root, target);
+    size_++;
   }
-  return iter->data;
+  return target->data;
 }
 
 template< typename Key, typename Value >
 typename sobolevsky::List< Value > &sobolevsky::MyMultiMap< Key, Value >::at(const Key &key)
 {
-  if (find(key) == end())
+  Node *target = findNode(key);
+  if (target == nullptr)
   {
     throw std::out_of_range("Such key does not exist\n");
   }
-  else
-  {
-    return (find(key));
-  }
+  return target->data;
 }
 
 template< typename Key, typename Value >
 void sobolevsky::MyMultiMap< Key, Value >::insert(const std::pair< Key, Value > &pair)
 {
-  if (find(pair.first) != end())
+  Node *target = findNode(pair.first);
+  if (target != nullptr)
   {
-    find(pair.first)->pushBack(pair.second);
-    size_++;
+    target->data.pushBack(pair.second);
   }
   else
   {
-    root = push(pair.first, pair.second, root);
-    size_++;
+    root = push(pair.first, pair.second, root, target);
   }
+  size_++;
 }
 
 template< typename Key, typename Value >
 typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key, Value >::push
-(const Key &key, const Value &value, Node *node_)
+(const Key &key, const Value &value, Node *node_, Node *&target)
 {
   if (node_ == nullptr)
   {
     node_ = new Node(key, value);
+    target = node_;
   }
   else if (key < node_->key_)
   {
-    node_->left = push(key, value, node_->left);
+    node_->left = push(key, value, node_->left, target);
     node_->left->parent = node_;
-    node_->height++;
-    if (height(node_->left) - height(node_->right) > 1)
-    {
-      if (node_->right == nullptr || key < node_->left->key_)
-      {
-        node_ = RightRotate(node_);
-      }
-      else
-      {
-        node_ = LeftRightRotate(node_);
-      }
-    }
+    node_ = balance(node_);
   }
   else if (key > node_->key_)
   {
-    node_->right = push(key, value, node_->right);
+    node_->right = push(key, value, node_->right, target);
     node_->right->parent = node_;
-    node_->height++;
-    if ((height(node_->right) - height(node_->left)) > 1)
-    {
-      if (node_->left == nullptr || key > node_->right->key_)
-      {
-        node_ = LeftRotate(node_);
-      }
-      else
-      {
-        node_ = RightLeftRotate(node_);
-      }
-    }
+    node_ = balance(node_);
+  }
+  else
+  {
+    target = node_;
   }
   return node_;
 }
@@ -272,10 +255,18 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
   else if (key < node_->key_)
   {
     node_->left = delet(key, node_->left);
+    if (node_->left != nullptr)
+    {
+      node_->left->parent = node_;
+    }
   }
   else if (key > node_->key_)
   {
     node_->right = delet(key, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else if (node_->left && node_->right)
   {
@@ -284,50 +275,48 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
     {
       temp = temp->left;
     }
-    node_->data = temp->data;
+    node_->key_ = temp->key_;
+    node_->data.swap(temp->data);
     node_->right = delet(node_->key_, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else
   {
     Node *temp = node_;
-    if (node_->left == nullptr)
-    {
-      node_ = node_->right;
-    }
-    else if (node_->right== nullptr)
+    node_ = (node_->left == nullptr ? node_->right : node_->left);
+    if (node_ != nullptr)
     {
-      node_ = node_->left;
+      node_->parent = temp->parent;
     }
+    temp->data.clear();
+    delete temp;
+    return node_;
   }
+  return balance(node_);
+}
 
-  if (node_ == nullptr)
-  {
-    return nullptr;
-  }
-
+template< typename Key, typename Value >
+typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key, Value >::balance(Node *node_)
+{
   node_->height = std::max(height(node_->left), height(node_->right)) + 1;
-
-  if (height(node_->left) - height(node_->right) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  if (height(node_->left) > height(node_->right) + 1)
   {
-    if (height(node_->left->left) - height(node_->left->right) > 0)
-    {
-      return LeftRotate(node_);
-    }
-    else if (node_->right != nullptr)
+    if (height(node_->left->right) > height(node_->left->left))
     {
-      return RightLeftRotate(node_);
+      return LeftRightRotate(node_);
     }
+    return RightRotate(node_);
   }
-  else if (height(node_->right) - height(node_->left) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  if (height(node_->right) > height(node_->left) + 1)
   {
-    if (height(node_->right->right) - height(node_->right->left) > 0)
+    if (height(node_->right->left) > height(node_->right->right))
     {
-      return RightRotate(node_);
-    }
-    else if (node_->left != nullptr)
-    {
-      return LeftRightRotate(node_);
+      return RightLeftRotate(node_);
     }
+    return LeftRotate(node_);
   }
   return node_;
 }
@@ -368,11 +357,8 @@ void sobolevsky::MyMultiMap< Key, Value >::swap(MyMultiMap &x)
 template< typename Key, typename Value >
 size_t sobolevsky::MyMultiMap< Key, Value >::count(const Key &key)
 {
-  if (find(key) == end())
-  {
-    return 0;
-  }
-  return find(key)->data.size();
+  Node *target = findNode(key);
+  return (target == nullptr ? 0 : target->data.size());
 }
 
 template< typename Key, typename Value >
@@ -587,24 +573,30 @@ typename sobolevsky::MyMultiMap< Key, Value >::ConstIterator sobolevsky::MyMulti
 
 template< typename Key, typename Value >
 typename sobolevsky::MyMultiMap< Key, Value >::Iterator sobolevsky::MyMultiMap< Key, Value >::find(const Key &key)
+{
+  return Iterator(findNode(key));
+}
+
+template< typename Key, typename Value >
+typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key, Value >::findNode(const Key &key) const
 {
   Node *temp = root;
   while (temp)
   {
-    if (temp->key_ == key)
+    if (key < temp->key_)
     {
-      return Iterator(temp);
+      temp = temp->left;
     }
-    else if (key > temp->key_)
+    else if (temp->key_ < key)
     {
       temp = temp->right;
     }
-    else if (key < temp->key_)
+    else
     {
-      temp = temp->left;
+      return temp;
     }
   }
-  return end();
+  return nullptr;
 }
 
 template< typename Key, typename Value >
@@ -31,12 +31,14 @@ void sobolevsky::getComplement(std::istream &in, bigTreeDeclaration &data)
   std::string name1;
   std::string name2;
   in >> newName >> name1 >> name2;
+  smallTreeDeclaration &tree1 = data.at(name1);
   smallTreeDeclaration newTree;
-  if (data.at(name1).getSize() != 0 && data.at(name2).getSize() != 0)
+  if (tree1.getSize() != 0 && data.at(name2).getSize() != 0)
   {
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name1).cbegin()); iter != data.at(name1).cend(); iter++)
+    smallTreeDeclaration &tree2 = data.at(name2);
+    for (smallTreeDeclaration::ConstIterator iter(tree1.cbegin()); iter != tree1.cend(); iter++)
     {
-      if (data.at(name2).find(iter->first) == data.at(name2).end())
+      if (tree2.count(iter->first) == 0)
       {
         newTree.insert(std::make_pair(iter->first, iter->second));
       }
@@ -52,12 +54,14 @@ void sobolevsky::getIntersect(std::istream &in, bigTreeDeclaration &data)
   std::string name1;
   std::string name2;
   in >> newName >> name1 >> name2;
+  smallTreeDeclaration &tree1 = data.at(name1);
   smallTreeDeclaration newTree;
-  if (data.at(name1).getSize() != 0 && data.at(name2).getSize() != 0)
+  if (tree1.getSize() != 0 && data.at(name2).getSize() != 0)
   {
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name1).cbegin()); iter != data.at(name1).cend(); iter++)
+    smallTreeDeclaration &tree2 = data.at(name2);
+    for (smallTreeDeclaration::ConstIterator iter(tree1.cbegin()); iter != tree1.cend(); iter++)
     {
-      if (data.at(name2).find(iter->first) != data.at(name2).end())
+      if (tree2.count(iter->first) != 0)
       {
         newTree.insert(std::make_pair(iter->first, iter->second));
       }
@@ -73,31 +77,33 @@ void sobolevsky::getUnion(std::istream &in, bigTreeDeclaration &data)
   std::string name1;
   std::string name2;
   in >> newName >> name1 >> name2;
+  smallTreeDeclaration &tree1 = data.at(name1);
+  smallTreeDeclaration &tree2 = data.at(name2);
   smallTreeDeclaration newTree;
-  if (data.at(name1).getSize() != 0 && data.at(name2).getSize() == 0)
+  if (tree1.getSize() != 0 && tree2.getSize() == 0)
   {
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name1).cbegin()); iter != data.at(name1).cend(); iter++)
+    for (smallTreeDeclaration::ConstIterator iter(tree1.cbegin()); iter != tree1.cend(); iter++)
     {
       newTree.insert(std::make_pair(iter->first, iter->second));
     }
   }
-  else if (data.at(name1).getSize() == 0 && data.at(name2).getSize() != 0)
+  else if (tree1.getSize() == 0 && tree2.getSize() != 0)
   {
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name2).cbegin()); iter != data.at(name2).cend(); iter++)
+    for (smallTreeDeclaration::ConstIterator iter(tree2.cbegin()); iter != tree2.cend(); iter++)
     {
       newTree.insert(std::make_pair(iter->first, iter->second));
     }
   }
-  else if (data.at(name1).getSize() != 0 || data.at(name2).getSize() != 0)
+  else if (tree1.getSize() != 0 || tree2.getSize() != 0)
   {
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name1).cbegin()); iter != data.at(name1).cend(); iter++)
+    for (smallTreeDeclaration::ConstIterator iter(tree1.cbegin()); iter != tree1.cend(); iter++)
     {
       newTree.insert(std::make_pair(iter->first, iter->second));
     }
 
-    for (smallTreeDeclaration::ConstIterator iter(data.at(name2).cbegin()); iter != data.at(name2).cend(); iter++)
+    for (smallTreeDeclaration::ConstIterator iter(tree2.cbegin()); iter != tree2.cend(); iter++)
     {
-      if (data.at(name1).find(iter->first) == data.at(name1).end())
+      if (tree1.count(iter->first) == 0)
       {
         newTree.insert(std::make_pair(iter->first, iter->second));
       }
@@ -1,23 +1,33 @@
 #include "commands.hpp"
 #include "keySumm.hpp"
+#include "valueOutput.hpp"
 
 void sobolevsky::ascending(std::ostream &out, const sobolevsky::AVLtree< long long, std::string, long long > &tree)
 {
   Key_summ keySumm;
   keySumm = tree.traverse_lnr< Key_summ >(keySumm);
-  out << keySumm.getKeyResult() << keySumm.getValueResult() << "\n";
+  out << keySumm.getKeyResult();
+  OutputBuffer buffer(out);
+  tree.traverse_lnr< Value_output >(Value_output(buffer));
+  buffer.put('\n');
 }
 
 void sobolevsky::descending(std::ostream &out, const sobolevsky::AVLtree< long long, std::string, long long > &tree)
 {
   Key_summ keySumm;
   keySumm = tree.traverse_rnl< Key_summ >(keySumm);
-  out << keySumm.getKeyResult() << keySumm.getValueResult() << "\n";
+  out << keySumm.getKeyResult();
+  OutputBuffer buffer(out);
+  tree.traverse_rnl< Value_output >(Value_output(buffer));
+  buffer.put('\n');
 }
 
 void sobolevsky::breadth(std::ostream &out, const sobolevsky::AVLtree< long long, std::string, long long > &tree)
 {
   Key_summ keySumm;
   keySumm = tree.traverse_breadth< Key_summ >(keySumm);
-  out << keySumm.getKeyResult() << keySumm.getValueResult() << "\n";
+  out << keySumm.getKeyResult();
+  OutputBuffer buffer(out);
+  tree.traverse_breadth< Value_output >(Value_output(buffer));
+  buffer.put('\n');
 }
@@ -1,8 +1,7 @@
 #include "keySumm.hpp"
 
 sobolevsky::Key_summ::Key_summ():
-  keyResult_(0),
-  valueResult_("")
+  keyResult_(0)
 {}
 
 void sobolevsky::Key_summ::operator()(const std::pair< const long long, std::string > &key_value)
@@ -15,15 +14,9 @@ void sobolevsky::Key_summ::operator()(const std::pair< const long long, std::str
     throw std::overflow_error("");
   }
   keyResult_ += key_value.first;
-  valueResult_ += (" " + key_value.second);
 }
 
 long long sobolevsky::Key_summ::getKeyResult()
 {
   return keyResult_;
 }
-
-std::string sobolevsky::Key_summ::getValueResult()
-{
-  return valueResult_;
-}
@@ -16,10 +16,8 @@ namespace sobolevsky
     void operator()(const std::pair< const long long, std::string > &key_value);
 
     long long getKeyResult();
-    std::string getValueResult();
   private:
     long long keyResult_;
-    std::string valueResult_;
   };
 }
 
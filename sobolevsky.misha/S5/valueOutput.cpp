@@ -0,0 +1,57 @@
+#include "valueOutput.hpp"
+#include <cstring>
+
+constexpr size_t sobolevsky::OutputBuffer::capacity_;
+
+sobolevsky::OutputBuffer::OutputBuffer(std::ostream &out):
+  out_(out),
+  size_(0)
+{}
+
+sobolevsky::OutputBuffer::~OutputBuffer()
+{
+  flush();
+}
+
+void sobolevsky::OutputBuffer::put(char c)
+{
+  if (size_ == capacity_)
+  {
+    flush();
+  }
+  data_[size_++] = c;
+}
+
+void sobolevsky::OutputBuffer::write(const std::string &str)
+{
+  if (str.size() > capacity_ - size_)
+  {
+    flush();
+    if (str.size() > capacity_)
+    {
+      out_.write(str.data(), str.size());
+      return;
+    }
+  }
+  std::memcpy(data_ + size_, str.data(), str.size());
+  size_ += str.size();
+}
+
+void sobolevsky::OutputBuffer::flush()
+{
+  if (size_ != 0)
+  {
+    out_.write(data_, size_);
+    size_ = 0;
+  }
+}
+
+sobolevsky::Value_output::Value_output(OutputBuffer &buffer):
+  buffer_(&buffer)
+{}
+
+void sobolevsky::Value_output::operator()(const std::pair< const long long, std::string > &key_value)
+{
+  buffer_->put(' ');
+  buffer_->write(key_value.second);
+}
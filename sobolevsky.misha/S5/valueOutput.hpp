@@ -0,0 +1,40 @@
+#ifndef VALUEOUTPUT_HPP
+#define VALUEOUTPUT_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace sobolevsky
+{
+  class OutputBuffer
+  {
+  public:
+    explicit OutputBuffer(std::ostream &out);
+    OutputBuffer(const OutputBuffer &rhs) = delete;
+    OutputBuffer &operator=(const OutputBuffer &rhs) = delete;
+    ~OutputBuffer();
+
+    void put(char c);
+    void write(const std::string &str);
+    void flush();
+  private:
+    static constexpr size_t capacity_ = 1 << 16;
+    std::ostream &out_;
+    char data_[capacity_];
+    size_t size_;
+  };
+
+  struct Value_output
+  {
+  public:
+    explicit Value_output(OutputBuffer &buffer);
+
+    void operator()(const std::pair< const long long, std::string > &key_value);
+  private:
+    OutputBuffer *buffer_;
+  };
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef FIXEDQUEUE_HPP
+#define FIXEDQUEUE_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace sobolevsky
+{
+  template< typename T >
+  class FixedQueue
+  {
+  public:
+    explicit FixedQueue(size_t capacity);
+    FixedQueue(const FixedQueue &rhs) = delete;
+    FixedQueue &operator=(const FixedQueue &rhs) = delete;
+    ~FixedQueue();
+
+    void push(const T &data);
+    T front() const;
+    void pop();
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+  private:
+    T *data_;
+    size_t capacity_;
+    size_t head_;
+    size_t size_;
+  };
+}
+
+template< typename T >
+sobolevsky::FixedQueue< T >::FixedQueue(size_t capacity):
+  data_(capacity == 0 ? nullptr : new T[capacity]),
+  capacity_(capacity),
+  head_(0),
+  size_(0)
+{}
+
+template< typename T >
+sobolevsky::FixedQueue< T >::~FixedQueue()
+{
+  delete[] data_;
+}
+
+template< typename T >
+void sobolevsky::FixedQueue< T >::push(const T &data)
+{
+  if (size_ == capacity_)
+  {
+    throw std::length_error("queue is full");
+  }
+  size_t tail = head_ + size_;
+  data_[tail < capacity_ ? tail : tail - capacity_] = data;
+  size_++;
+}
+
+template< typename T >
+T sobolevsky::FixedQueue< T >::front() const
+{
+  if (size_ == 0)
+  {
+    throw std::logic_error("queue is empty");
+  }
+  return data_[head_];
+}
+
+template< typename T >
+void sobolevsky::FixedQueue< T >::pop()
+{
+  if (size_ != 0)
+  {
+    head_ = (head_ + 1 == capacity_) ? 0 : head_ + 1;
+    size_--;
+  }
+}
+
+template< typename T >
+bool sobolevsky::FixedQueue< T >::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename T >
+size_t sobolevsky::FixedQueue< T >::size() const noexcept
+{
+  return size_;
+}
+
+#endif
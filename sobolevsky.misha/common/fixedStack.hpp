@@ -0,0 +1,84 @@
+#ifndef FIXEDSTACK_HPP
+#define FIXEDSTACK_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace sobolevsky
+{
+  template< typename T >
+  class FixedStack
+  {
+  public:
+    explicit FixedStack(size_t capacity);
+    FixedStack(const FixedStack &rhs) = delete;
+    FixedStack &operator=(const FixedStack &rhs) = delete;
+    ~FixedStack();
+
+    void push(const T &data);
+    T top() const;
+    void pop();
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+  private:
+    T *data_;
+    size_t capacity_;
+    size_t size_;
+  };
+}
+
+template< typename T >
+sobolevsky::FixedStack< T >::FixedStack(size_t capacity):
+  data_(capacity == 0 ? nullptr : new T[capacity]),
+  capacity_(capacity),
+  size_(0)
+{}
+
+template< typename T >
+sobolevsky::FixedStack< T >::~FixedStack()
+{
+  delete[] data_;
+}
+
+template< typename T >
+void sobolevsky::FixedStack< T >::push(const T &data)
+{
+  if (size_ == capacity_)
+  {
+    throw std::length_error("stack is full");
+  }
+  data_[size_++] = data;
+}
+
+template< typename T >
+T sobolevsky::FixedStack< T >::top() const
+{
+  if (size_ == 0)
+  {
+    throw std::logic_error("stack is empty");
+  }
+  return data_[size_ - 1];
+}
+
+template< typename T >
+void sobolevsky::FixedStack< T >::pop()
+{
+  if (size_ != 0)
+  {
+    size_--;
+  }
+}
+
+template< typename T >
+bool sobolevsky::FixedStack< T >::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename T >
+size_t sobolevsky::FixedStack< T >::size() const noexcept
+{
+  return size_;
+}
+
+#endif
@@ -6,8 +6,9 @@
 #include <algorithm>
 #include <stdexcept>
 #include <iterator>
-#include <queue.hpp>
-#include <stack.hpp>
+#include <limits>
+#include <fixedQueue.hpp>
+#include <fixedStack.hpp>
 
 namespace sobolevsky
 {
@@ -45,8 +46,13 @@ namespace sobolevsky
     void swap(AVLtree &x) noexcept;
 
     Iterator find(const Key &key);
-    size_t count(const Key &key);
+    size_t count(const Key &key) const;
     std::pair< Iterator, Iterator > equal_range(const Key &key);
+    Iterator lower_bound(const Key &key);
+    Iterator upper_bound(const Key &key);
+    size_t rank(const Key &key) const;
+    Iterator select(size_t index);
+    size_t count_range(const Key &low, const Key &high) const;
 
     template< typename F >
     F traverse_lnr(F f) const;
@@ -63,13 +69,19 @@ namespace sobolevsky
   private:
     class Node;
 
-    Node *push(const Key &key, const Value &value, Node *node_);
+    Node *push(const Key &key, const Value &value, Node *node_, Node *&target);
     Node *RightRotate(Node *node_);
     Node *LeftRotate(Node *node_);
     Node *LeftRightRotate(Node *node_);
     Node *RightLeftRotate(Node *node_);
     Node *remove(const Key &key, Node *node_);
     size_t height(Node *node_);
+    Node *balance(Node *node_);
+    static size_t subtreeSize(const Node *node_) noexcept;
+    void updateSize(Node *node_) noexcept;
+    Node *findNode(const Key &key) const;
+    size_t traverseDepth() const noexcept;
+    size_t traverseWidth() const noexcept;
     void recurionDeleteAll(Node *node);
 
     Node *root;
@@ -87,6 +99,7 @@ public:
     right(nullptr),
     parent(nullptr),
     height(1),
+    size(1),
     data(std::pair< Key, Value >(key, value))
   {}
 private:
@@ -94,6 +107,7 @@ private:
   Node *right;
   Node *parent;
   size_t height;
+  size_t size;
   std::pair< Key, Value > data;
 };
 
@@ -133,76 +147,58 @@ bool sobolevsky::AVLtree< Key, Value, Compare >::isEmpty() const noexcept
 template< typename Key, typename Value, typename Compare >
 Value &sobolevsky::AVLtree< Key, Value, Compare >::operator[](const Key &key)
 {
-  Iterator iter(find(key));
-  if (iter == end())
+  Node *target = findNode(key);
+  if (target == nullptr)
   {
-    insert(std::pair< Key, Value>(key, Value()));
-    iter = find(key);
+    root = push(key, Value(), root, target);
+    size_++;
   }
-  return iter->second;
+  return target->data.second;
 }
 
 template< typename Key, typename Value, typename Compare >
 Value &sobolevsky::AVLtree< Key, Value, Compare >::at(const Key &key)
 {
-  if (find(key) == end())
+  Node *target = findNode(key);
+  if (target == nullptr)
   {
     throw std::out_of_range("Such key does not exist\n");
   }
-  else
-  {
-    return (find(key))->second;
-  }
+  return target->data.second;
 }
 
 template< typename Key, typename Value, typename Compare >
 void sobolevsky::AVLtree< Key, Value, Compare >::insert(const std::pair< Key, Value > &pair)
 {
-  root = push(pair.first, pair.second, root);
-  size_++;
+  Node *target = nullptr;
+  root = push(pair.first, pair.second, root, target);
+  size_ = subtreeSize(root);
 }
 
 template< typename Key, typename Value, typename Compare >
 typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree< Key, Value, Compare >::push
-(const Key &key, const Value &value, Node *node_)
+(const Key &key, const Value &value, Node *node_, Node *&target)
 {
   if (node_ == nullptr)
   {
     node_ = new Node(key, value);
+    target = node_;
   }
   else if (key < node_->data.first)
   {
-    node_->left = push(key, value, node_->left);
+    node_->left = push(key, value, node_->left, target);
     node_->left->parent = node_;
-    node_->height++;
-    if (height(node_->left) - height(node_->right) > 1)
-    {
-      if (node_->right == nullptr || key < node_->left->data.first)
-      {
-        node_ = RightRotate(node_);
-      }
-      else
-      {
-        node_ = LeftRightRotate(node_);
-      }
-    }
+    node_ = balance(node_);
   }
   else if (key > node_->data.first)
   {
-    node_->right = push(key, value, node_->right);
+    node_->right = push(key, value, node_->right, target);
     node_->right->parent = node_;
-    node_->height++;
-    if ((height(node_->right) - height(node_->left)) > 1)
-    {
-      if (node_->left == nullptr || key > node_->right->data.first)
-      {
-        node_ = LeftRotate(node_);
-      }
-      else
-      {
-        node_ = RightLeftRotate(node_);
-      }
-    }
+    node_ = balance(node_);
+  }
+  else
+  {
+    target = node_;
   }
   return node_;
 }
@@ -221,6 +217,8 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
   temp->right = node_;
   node_->height = std::max(height(node_->left), height(node_->right)) + 1;
   temp->height = std::max(node_->height, height(temp->left)) + 1;
+  updateSize(node_);
+  updateSize(temp);
   return temp;
 }
 
@@ -238,6 +236,8 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
   temp->left = node_;
   node_->height = std::max(height(node_->left), height(node_->right)) + 1;
   temp->height = std::max(node_->height, height(temp->right)) + 1;
+  updateSize(node_);
+  updateSize(temp);
   return temp;
 }
 
@@ -280,10 +280,18 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
   else if (key < node_->data.first)
   {
     node_->left = remove(key, node_->left);
+    if (node_->left != nullptr)
+    {
+      node_->left->parent = node_;
+    }
   }
   else if (key > node_->data.first)
   {
     node_->right = remove(key, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else if (node_->left && node_->right)
   {
@@ -294,56 +302,109 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
     }
     node_->data = temp->data;
     node_->right = remove(node_->data.first, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else
   {
     Node *temp = node_;
-    if (node_->left == nullptr)
+    node_ = (node_->left == nullptr ? node_->right : node_->left);
+    if (node_ != nullptr)
     {
-      node_ = node_->right;
-    }
-    else if (node_->right== nullptr)
-    {
-      node_ = node_->left;
+      node_->parent = temp->parent;
     }
+    delete temp;
+    return node_;
   }
+  return balance(node_);
+}
 
-  if (node_ == nullptr)
-  {
-    return nullptr;
-  }
-
+template< typename Key, typename Value, typename Compare >
+typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree< Key, Value, Compare >::balance(Node *node_)
+{
   node_->height = std::max(height(node_->left), height(node_->right)) + 1;
-
-  if (height(node_->left) - height(node_->right) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  updateSize(node_);
+  if (height(node_->left) > height(node_->right) + 1)
   {
-    if (height(node_->left->left) - height(node_->left->right) > 0)
+    if (height(node_->left->right) > height(node_->left->left))
     {
-      return LeftRotate(node_);
+      return LeftRightRotate(node_);
     }
-    else if (node_->right != nullptr)
+    return RightRotate(node_);
+  }
+  if (height(node_->right) > height(node_->left) + 1)
+  {
+    if (height(node_->right->left) > height(node_->right->right))
     {
       return RightLeftRotate(node_);
     }
+    return LeftRotate(node_);
   }
-  else if (height(node_->right) - height(node_->left) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  return node_;
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t sobolevsky::AVLtree< Key, Value, Compare >::height(Node *node_)
+{
+  return (node_ == nullptr ? 0 : node_->height);
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t sobolevsky::AVLtree< Key, Value, Compare >::subtreeSize(const Node *node_) noexcept
+{
+  return (node_ == nullptr ? 0 : node_->size);
+}
+
+template< typename Key, typename Value, typename Compare >
+void sobolevsky::AVLtree< Key, Value, Compare >::updateSize(Node *node_) noexcept
+{
+  node_->size = subtreeSize(node_->left) + subtreeSize(node_->right) + 1;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree< Key, Value, Compare >::findNode
+(const Key &key) const
+{
+  Node *temp = root;
+  while (temp != nullptr)
   {
-    if (height(node_->right->right) - height(node_->right->left) > 0)
+    if (key < temp->data.first)
     {
-      return RightRotate(node_);
+      temp = temp->left;
     }
-    else if (node_->left != nullptr)
+    else if (temp->data.first < key)
     {
-      return LeftRightRotate(node_);
+      temp = temp->right;
+    }
+    else
+    {
+      return temp;
     }
   }
-  return node_;
+  return nullptr;
 }
 
 template< typename Key, typename Value, typename Compare >
-size_t sobolevsky::AVLtree< Key, Value, Compare >::height(Node *node_)
+size_t sobolevsky::AVLtree< Key, Value, Compare >::traverseDepth() const noexcept
 {
-  return (node_ == nullptr ? 0 : node_->height);
+  return (root == nullptr ? 0 : std::min(root->height, size_));
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t sobolevsky::AVLtree< Key, Value, Compare >::traverseWidth() const noexcept
+{
+  size_t depth = traverseDepth();
+  if (depth == 0)
+  {
+    return 0;
+  }
+  if (depth - 1 >= std::numeric_limits< size_t >::digits)
+  {
+    return size_;
+  }
+  return std::min(size_t(1) << (depth - 1), size_);
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -377,36 +438,112 @@ void sobolevsky::AVLtree< Key, Value, Compare >::swap(AVLtree &x) noexcept
 }
 
 template< typename Key, typename Value, typename Compare >
-size_t sobolevsky::AVLtree< Key, Value, Compare >::count(const Key &key)
+size_t sobolevsky::AVLtree< Key, Value, Compare >::count(const Key &key) const
 {
-  if (find(key) == end())
-  {
-    return 0;
-  }
-  return 1;
+  return (findNode(key) == nullptr ? 0 : 1);
 }
 
 template< typename Key, typename Value, typename Compare >
 std::pair< typename sobolevsky::AVLtree< Key, Value, Compare >::Iterator, typename sobolevsky::AVLtree< Key, Value,
 Compare >::Iterator > sobolevsky::AVLtree< Key, Value, Compare >::equal_range(const Key &key)
 {
-  if (find(key) == end())
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template< typename Key, typename Value, typename Compare >
+typename sobolevsky::AVLtree< Key, Value, Compare >::Iterator sobolevsky::AVLtree< Key, Value, Compare >::lower_bound
+(const Key &key)
+{
+  Node *temp = root;
+  Node *result = nullptr;
+  while (temp != nullptr)
   {
-    Iterator iter(begin());
-    while (iter != end())
+    if (temp->data.first < key)
+    {
+      temp = temp->right;
+    }
+    else
     {
-      if ((*iter).first > key)
-      {
-        break;
-      }
-      iter++;
+      result = temp;
+      temp = temp->left;
     }
-    return std::make_pair(iter, iter);
   }
-  else
+  return Iterator(result);
+}
+
+template< typename Key, typename Value, typename Compare >
+typename sobolevsky::AVLtree< Key, Value, Compare >::Iterator sobolevsky::AVLtree< Key, Value, Compare >::upper_bound
+(const Key &key)
+{
+  Node *temp = root;
+  Node *result = nullptr;
+  while (temp != nullptr)
   {
-    return std::make_pair(find(key), find(key)++);
+    if (key < temp->data.first)
+    {
+      result = temp;
+      temp = temp->left;
+    }
+    else
+    {
+      temp = temp->right;
+    }
+  }
+  return Iterator(result);
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t sobolevsky::AVLtree< Key, Value, Compare >::rank(const Key &key) const
+{
+  const Node *temp = root;
+  size_t result = 0;
+  while (temp != nullptr)
+  {
+    if (temp->data.first < key)
+    {
+      result += subtreeSize(temp->left) + 1;
+      temp = temp->right;
+    }
+    else
+    {
+      temp = temp->left;
+    }
   }
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename sobolevsky::AVLtree< Key, Value, Compare >::Iterator sobolevsky::AVLtree< Key, Value, Compare >::select(size_t index)
+{
+  Node *temp = root;
+  while (temp != nullptr)
+  {
+    size_t leftSize = subtreeSize(temp->left);
+    if (index < leftSize)
+    {
+      temp = temp->left;
+    }
+    else if (index == leftSize)
+    {
+      return Iterator(temp);
+    }
+    else
+    {
+      index -= leftSize + 1;
+      temp = temp->right;
+    }
+  }
+  return end();
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t sobolevsky::AVLtree< Key, Value, Compare >::count_range(const Key &low, const Key &high) const
+{
+  if (high < low)
+  {
+    return 0;
+  }
+  return rank(high) - rank(low) + count(high);
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -657,23 +794,7 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::ConstIterator sobolevsky::A
 template< typename Key, typename Value, typename Compare >
 typename sobolevsky::AVLtree< Key, Value, Compare >::Iterator sobolevsky::AVLtree< Key, Value, Compare >::find(const Key &key)
 {
-  Node *temp = root;
-  while (temp)
-  {
-    if (temp->data.first == key)
-    {
-      return Iterator(temp);
-    }
-    else if (key > temp->data.first)
-    {
-      temp = temp->right;
-    }
-    else if (key < temp->data.first)
-    {
-      temp = temp->left;
-    }
-  }
-  return end();
+  return Iterator(findNode(key));
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -894,7 +1015,7 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_lnr(F f) const
 {
-  Stack< const Node* > stack;
+  FixedStack< const Node* > stack(traverseDepth());
   const Node * temp = root;
   while (!(stack.empty()) || temp != nullptr)
   {
@@ -915,7 +1036,7 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_rnl(F f) const
 {
-  Stack< const Node* > stack;
+  FixedStack< const Node* > stack(traverseDepth());
   const Node * temp = root;
   while (!(stack.empty()) || temp != nullptr)
   {
@@ -936,11 +1057,14 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_breadth(F f) const
 {
-  Queue< const Node* > queue;
-  queue.push(root);
+  FixedQueue< const Node* > queue(traverseWidth());
+  if (root != nullptr)
+  {
+    queue.push(root);
+  }
   while (!(queue.empty()))
   {
-    const Node *temp = queue.back();
+    const Node *temp = queue.front();
     queue.pop();
     if (temp->left != nullptr)
     {
@@ -959,7 +1083,7 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_lnr(F f)
 {
-  Stack< Node* > stack;
+  FixedStack< Node* > stack(traverseDepth());
   Node * temp = root;
   while (!(stack.empty()) || temp != nullptr)
   {
@@ -980,7 +1104,7 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_rnl(F f)
 {
-  Stack< Node* > stack;
+  FixedStack< Node* > stack(traverseDepth());
   Node * temp = root;
   while (!(stack.empty()) || temp != nullptr)
   {
@@ -1001,11 +1125,14 @@ template< typename Key, typename Value, typename Compare >
 template< typename F >
 F sobolevsky::AVLtree< Key, Value, Compare >::traverse_breadth(F f)
 {
-  Queue< Node* > queue;
-  queue.push(root);
+  FixedQueue< Node* > queue(traverseWidth());
+  if (root != nullptr)
+  {
+    queue.push(root);
+  }
   while (!(queue.empty()))
   {
-    Node *temp = queue.back();
+    Node *temp = queue.front();
     queue.pop();
     if (temp->left != nullptr)
     {
@@ -0,0 +1,194 @@
+#include "DistanceMatrix.hpp"
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <utility>
+
+namespace sukacheva
+{
+  constexpr size_t DistanceMatrix::infinity;
+
+  namespace
+  {
+    constexpr size_t blockSize = 64;
+
+    template< typename F >
+    void runInParallel(size_t jobs, F job)
+    {
+      size_t threadCount = getThreadCount(jobs);
+      if (threadCount < 2)
+      {
+        for (size_t i = 0; i < jobs; ++i)
+        {
+          job(i);
+        }
+        return;
+      }
+      std::vector< std::exception_ptr > errors(threadCount);
+      std::vector< std::thread > threads;
+      threads.reserve(threadCount);
+      for (size_t t = 0; t < threadCount; ++t)
+      {
+        threads.emplace_back([&, t]()
+        {
+          try
+          {
+            for (size_t i = t; i < jobs; i += threadCount)
+            {
+              job(i);
+            }
+          }
+          catch (...)
+          {
+            errors[t] = std::current_exception();
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+      for (const auto& error : errors)
+      {
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+      }
+    }
+  }
+
+  size_t getThreadCount(size_t jobs)
+  {
+    size_t hardware = std::thread::hardware_concurrency();
+    return std::min(jobs, std::max(hardware, size_t(1)));
+  }
+
+  DistanceMatrix::DistanceMatrix(size_t size):
+    size_(size),
+    cells_(size * size, infinity)
+  {
+    for (size_t i = 0; i < size_; ++i)
+    {
+      at(i, i) = 0;
+    }
+  }
+
+  size_t DistanceMatrix::size() const noexcept
+  {
+    return size_;
+  }
+
+  size_t& DistanceMatrix::at(size_t row, size_t column) noexcept
+  {
+    return cells_[row * size_ + column];
+  }
+
+  size_t DistanceMatrix::at(size_t row, size_t column) const noexcept
+  {
+    return cells_[row * size_ + column];
+  }
+
+  size_t* DistanceMatrix::row(size_t index) noexcept
+  {
+    return cells_.data() + index * size_;
+  }
+
+  const size_t* DistanceMatrix::row(size_t index) const noexcept
+  {
+    return cells_.data() + index * size_;
+  }
+
+  void DistanceMatrix::floydWarshall()
+  {
+    const size_t blocks = (size_ + blockSize - 1) / blockSize;
+    for (size_t pivot = 0; pivot < blocks; ++pivot)
+    {
+      relaxBlock(pivot, pivot, pivot);
+      runInParallel(blocks, [this, pivot](size_t block)
+      {
+        if (block != pivot)
+        {
+          relaxBlock(pivot, block, pivot);
+          relaxBlock(block, pivot, pivot);
+        }
+      });
+      runInParallel(blocks, [this, pivot, blocks](size_t rowBlock)
+      {
+        if (rowBlock == pivot)
+        {
+          return;
+        }
+        for (size_t columnBlock = 0; columnBlock < blocks; ++columnBlock)
+        {
+          if (columnBlock != pivot)
+          {
+            relaxBlock(rowBlock, columnBlock, pivot);
+          }
+        }
+      });
+    }
+  }
+
+  void DistanceMatrix::relaxBlock(size_t rowBlock, size_t columnBlock, size_t pivotBlock)
+  {
+    const size_t rowEnd = std::min(size_, (rowBlock + 1) * blockSize);
+    const size_t columnBegin = columnBlock * blockSize;
+    const size_t columnEnd = std::min(size_, columnBegin + blockSize);
+    const size_t pivotEnd = std::min(size_, (pivotBlock + 1) * blockSize);
+    for (size_t k = pivotBlock * blockSize; k < pivotEnd; ++k)
+    {
+      const size_t* pivotRow = row(k);
+      for (size_t i = rowBlock * blockSize; i < rowEnd; ++i)
+      {
+        size_t* current = row(i);
+        const size_t toPivot = current[k];
+        if (toPivot == infinity)
+        {
+          continue;
+        }
+        for (size_t j = columnBegin; j < columnEnd; ++j)
+        {
+          if (pivotRow[j] != infinity && toPivot + pivotRow[j] < current[j])
+          {
+            current[j] = toPivot + pivotRow[j];
+          }
+        }
+      }
+    }
+  }
+
+  DistanceMatrix AdjacencySnapshot::dijkstraDistances() const
+  {
+    using entry = std::pair< size_t, size_t >;
+    const size_t vertexCount = offsets.empty() ? 0 : offsets.size() - 1;
+    DistanceMatrix result(vertexCount);
+    runInParallel(vertexCount, [this, &result](size_t source)
+    {
+      size_t* distances = result.row(source);
+      std::priority_queue< entry, std::vector< entry >, std::greater< entry > > queue;
+      queue.push({ 0, source });
+      while (!queue.empty())
+      {
+        entry top = queue.top();
+        queue.pop();
+        if (top.first > distances[top.second])
+        {
+          continue;
+        }
+        for (size_t i = offsets[top.second]; i < offsets[top.second + 1]; ++i)
+        {
+          size_t candidate = top.first + weights[i];
+          if (candidate < distances[targets[i]])
+          {
+            distances[targets[i]] = candidate;
+            queue.push({ candidate, targets[i] });
+          }
+        }
+      }
+    });
+    return result;
+  }
+}
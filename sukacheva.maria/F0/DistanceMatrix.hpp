@@ -0,0 +1,43 @@
+#ifndef DISTANCEMATRIX_HPP
+#define DISTANCEMATRIX_HPP
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace sukacheva
+{
+  class DistanceMatrix
+  {
+  public:
+    static constexpr size_t infinity = std::numeric_limits< size_t >::max();
+
+    DistanceMatrix() = default;
+    explicit DistanceMatrix(size_t size);
+
+    size_t size() const noexcept;
+    size_t& at(size_t row, size_t column) noexcept;
+    size_t at(size_t row, size_t column) const noexcept;
+    size_t* row(size_t index) noexcept;
+    const size_t* row(size_t index) const noexcept;
+
+    void floydWarshall();
+  private:
+    size_t size_ = 0;
+    std::vector< size_t > cells_;
+
+    void relaxBlock(size_t rowBlock, size_t columnBlock, size_t pivotBlock);
+  };
+
+  struct AdjacencySnapshot
+  {
+    std::vector< size_t > offsets;
+    std::vector< size_t > targets;
+    std::vector< size_t > weights;
+
+    DistanceMatrix dijkstraDistances() const;
+  };
+
+  size_t getThreadCount(size_t jobs);
+}
+
+#endif
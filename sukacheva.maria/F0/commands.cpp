@@ -5,6 +5,7 @@
 #include <fstream>
 #include <limits>
 #include <iterator>
+#include <sstream>
 #include "ErrorMessage.hpp"
 
 namespace sukacheva
@@ -22,7 +23,8 @@ namespace sukacheva
     out << "delete <vertex> <name> - deleting vertex name\n";
     out << "delete < edge > < first, second > - deleting an edge between the vertices first and second\n";
     out << "capacity <graphname> - displays the number of vertices in the graph graphname\n";
-    out << "weightTable <graphname> - displays the weight table of the graph graphname\n";
+    out << "weightTable [weight|distance|dijkstra] - displays the weight table of the actual graph, ";
+    out << "or the shortest distances between all vertices (Floyd-Warshall or Dijkstra from every vertex)\n";
     out << "print <path> <name> - prints the shortest paths from the top name to the rest.\n";
     out << "print <distance> <name> - prints the lengths of the shortest paths from the vertex name to the rest.\n";
     out << "open <filename> - open a file for reading with a given name\n";
@@ -279,27 +281,58 @@ namespace sukacheva
     }
   }
 
-  void printMatrix(GraphList& graphList, std::ostream& out)
+  void printMatrix(const DistanceMatrix& matrix, std::ostream& out)
   {
-    List< List< size_t > > weightTable = graphList.findActiveWorkspace().weightTable();
-    size_t rows = weightTable.getSize();
+    size_t rows = matrix.size();
     for (size_t i = 0; i < rows; i++)
     {
+      const size_t* row = matrix.row(i);
       for (size_t j = 0; j < rows; j++)
       {
-        if (*weightTable[i]->operator[](j) == std::numeric_limits<size_t>::max())
+        if (row[j] == DistanceMatrix::infinity)
         {
           out << "inf ";
         }
         else
         {
-          out << *weightTable[i]->operator[](j) << " ";
+          out << row[j] << " ";
         }
       }
       out << "\n";
     }
   }
 
+  void printMatrix(GraphList& graphList, std::ostream& out)
+  {
+    printMatrix(graphList.findActiveWorkspace().weightTable(), out);
+  }
+
+  void commandWeightTable(GraphList& graphList, std::istream& in, std::ostream& out)
+  {
+    std::string line;
+    std::getline(in, line);
+    std::istringstream args(line);
+    std::string mode;
+    args >> mode;
+    Graph& graph = graphList.findActiveWorkspace();
+    if (mode.empty() || mode == "weight")
+    {
+      printMatrix(graph.weightTable(), out);
+    }
+    else if (mode == "distance")
+    {
+      printMatrix(graph.distanceTable(), out);
+    }
+    else if (mode == "dijkstra")
+    {
+      printMatrix(graph.dijkstraDistances(), out);
+    }
+    else
+    {
+      ErrorMessage(out);
+    }
+  }
+
   void commandOpen(GraphList& graphList, std::istream& in, std::ostream& out)
   {
     Graph graph;
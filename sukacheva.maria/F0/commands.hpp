@@ -10,7 +10,9 @@ namespace sukacheva
   void graphName(GraphList& graphList, std::ostream& out);
   void clearGraph(GraphList& graphList, std::ostream& out);
   void printGraphList(std::ostream& out, GraphList graphList);
+  void printMatrix(const DistanceMatrix& matrix, std::ostream& out);
   void printMatrix(GraphList& graphList, std::ostream& out);
+  void commandWeightTable(GraphList& graphList, std::istream& in, std::ostream& out);
   void commandCreateGraph(GraphList& graphList, std::istream& in, std::ostream& out);
   void commandAdd(GraphList& graphList, std::istream& in, std::ostream& out);
   void commandPrint(GraphList& graphList, std::istream& in, std::ostream& out);
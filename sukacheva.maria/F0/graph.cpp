@@ -71,6 +71,10 @@ namespace sukacheva
       BST< size_t, size_t > updatedAdj;
       for (auto adjIt = it->second.begin(); adjIt != it->second.end(); ++adjIt)
       {
+        if (adjIt->first == key)
+        {
+          continue;
+        }
         size_t adjKey = adjIt->first > key ? adjIt->first - 1 : adjIt->first;
         updatedAdj.insert(adjKey, adjIt->second);
       }
@@ -180,7 +184,7 @@ namespace sukacheva
     size_t keyEnd = getVertexIndex(end);
     for (size_t at = keyEnd; at != keyStart; at = predecessors[at])
     {
-      if (at == std::numeric_limits< size_t >::max())
+      if (at == std::numeric_limits< size_t >::max() || predecessors.find(at) == predecessors.end())
       {
         path.pushFront("unattainable");
         return path;
@@ -191,28 +195,49 @@ namespace sukacheva
     return path;
   }
 
-  List< List< size_t > > Graph::weightTable()
+  AdjacencySnapshot Graph::snapshot() const
   {
-    size_t vertexCount = VertexesList.size();
-    List< List< size_t > > matrix(vertexCount, List< size_t >(vertexCount, std::numeric_limits< size_t >::max()));
-    for (size_t i = 0; i < vertexCount; ++i)
+    AdjacencySnapshot result;
+    result.offsets.reserve(AdjacencyList.size() + 1);
+    result.offsets.push_back(0);
+    for (auto it = AdjacencyList.cbegin(); it != AdjacencyList.cend(); ++it)
     {
-      *matrix[i]->operator[](i) = 0;
+      for (auto edgeIt = it->second.cbegin(); edgeIt != it->second.cend(); ++edgeIt)
+      {
+        result.targets.push_back(edgeIt->first);
+        result.weights.push_back(edgeIt->second);
+      }
+      result.offsets.push_back(result.targets.size());
     }
+    return result;
+  }
+
+  DistanceMatrix Graph::dijkstraDistances()
+  {
+    return snapshot().dijkstraDistances();
+  }
+
+  DistanceMatrix Graph::weightTable()
+  {
+    DistanceMatrix matrix(AdjacencyList.size());
     for (auto it = AdjacencyList.cbegin(); it != AdjacencyList.cend(); ++it)
     {
-      size_t from = it->first;
-      const auto& edges = it->second;
-      for (auto edgeIt = edges.cbegin(); edgeIt != edges.cend(); ++edgeIt)
+      size_t* row = matrix.row(it->first);
+      for (auto edgeIt = it->second.cbegin(); edgeIt != it->second.cend(); ++edgeIt)
       {
-        size_t to = edgeIt->first;
-        size_t weight = edgeIt->second;
-        *matrix[from]->operator[](to) = weight;
+        row[edgeIt->first] = edgeIt->second;
       }
     }
     return matrix;
   }
 
+  DistanceMatrix Graph::distanceTable()
+  {
+    DistanceMatrix matrix = weightTable();
+    matrix.floydWarshall();
+    return matrix;
+  }
+
   bool Graph::isVertexExist(std::string& name)
   {
     auto it = VertexesList.end();
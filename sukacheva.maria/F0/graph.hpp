@@ -3,6 +3,7 @@
 #include <string>
 #include "BST.hpp"
 #include "List.hpp"
+#include "DistanceMatrix.hpp"
 
 namespace sukacheva
 {
@@ -26,13 +27,17 @@ namespace sukacheva
     size_t getVertexIndex(std::string& name);
     std::pair< BST< size_t, size_t >, BST< size_t, size_t > > dijkstraDistances(std::string name);
     List< std::string > dijkstraPath(const BST< size_t, size_t >& predecessors, std::string start, std::string end);
-    List< List< size_t > > weightTable();
+    DistanceMatrix dijkstraDistances();
+    DistanceMatrix weightTable();
+    DistanceMatrix distanceTable();
     bool isVertexExist(std::string& name);
     bool isEdgeExist(std::string& start, std::string& end);
 
     Graph& operator=(const Graph& graph) = default;
   private:
     BST< size_t, BST< size_t, size_t > > AdjacencyList;
+
+    AdjacencySnapshot snapshot() const;
   };
   std::istream& operator>>(std::istream& in, Graph& applicant);
 }
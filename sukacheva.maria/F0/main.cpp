@@ -24,7 +24,7 @@ int main()
     commands["print"] = std::bind(commandPrint, _1, _2, _3);
     commands["delete"] = std::bind(commandDelete, _1, _2, _3);
     commands["work"] = std::bind(commandSwitch, _1, _2, _3);
-    commands["weightTable"] = std::bind(printMatrix, _1, _3);
+    commands["weightTable"] = std::bind(commandWeightTable, _1, _2, _3);
     commands["open"] = std::bind(commandOpen, _1, _2, _3);
     commands["save"] = std::bind(commandSave, _1, _2, _3);
   }
@@ -45,7 +45,8 @@ namespace sukacheva
     ConstIterator cbegin() const;
     ConstIterator cend() const;
 
-    Value& operator[](Key k) const;
+    Value& operator[](const Key& k);
+    const Value& operator[](const Key& k) const;
     BST& operator=(const BST& other);
     BST& operator=(BST&& other) noexcept;
 
@@ -60,6 +61,7 @@ namespace sukacheva
     Compare cmp;
 
     TreeNode* findMin(TreeNode* node) const;
+    TreeNode* findNode(const Key& k) const;
     TreeNode* findMax(TreeNode* node) const;
     TreeNode* pushNode(TreeNode* node, Key k, Value v, TreeNode* parent);
     TreeNode* balance(TreeNode* node);
@@ -239,14 +241,9 @@ namespace sukacheva
     {
       return *this;
     }
-    BST< Key, Value, Compare > temp;
-    temp.root = other.root;
-    if (temp.size() == other.size())
-    {
-      clear(root);
-      root = temp.root;
-      cmp = other.cmp;
-    }
+    BST< Key, Value, Compare > temp(other);
+    std::swap(root, temp.root);
+    cmp = other.cmp;
     return *this;
   }
 
@@ -379,15 +376,52 @@ namespace sukacheva
         return it->second;
       }
     }
-    throw std::runtime_error("Key not found");
+    throw std::out_of_range("Key not found");
+  }
+
+  template< typename Key, typename Value, typename Compare >
+  Value& BST< Key, Value, Compare >::operator[](const Key& k)
+  {
+    TreeNode* node = findNode(k);
+    if (!node)
+    {
+      insert(k, Value());
+      node = findNode(k);
+    }
+    return node->data.second;
+  }
+
+  template< typename Key, typename Value, typename Compare >
+  const Value& BST< Key, Value, Compare >::operator[](const Key& k) const
+  {
+    TreeNode* node = findNode(k);
+    if (!node)
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return node->data.second;
   }
 
   template< typename Key, typename Value, typename Compare >
-  Value& BST< Key, Value, Compare >::operator[](Key k) const
+  typename BST< Key, Value, Compare >::TreeNode* BST< Key, Value, Compare >::findNode(const Key& k) const
   {
-    Value val = at(k);
-    Value &valRef{val};
-    return valRef;
+    TreeNode* node = root;
+    while (node)
+    {
+      if (cmp(k, node->data.first))
+      {
+        node = node->left;
+      }
+      else if (cmp(node->data.first, k))
+      {
+        node = node->right;
+      }
+      else
+      {
+        return node;
+      }
+    }
+    return nullptr;
   }
 
   template< typename Key, typename Value, typename Compare >
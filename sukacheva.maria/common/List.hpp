@@ -4,6 +4,7 @@
 #include <iostream>
 #include <cassert>
 #include <memory>
+#include <utility>
 #include <initializer_list>
 #include "Node.hpp"
 
@@ -53,8 +54,8 @@ namespace sukacheva {
     ConstIterator cbegin() const;
     ConstIterator cend() const;
 
-    List& operator=(const List& other) = default;
-    List& operator=(List&& other) noexcept = default;
+    List& operator=(const List& other);
+    List& operator=(List&& other) noexcept;
   private:
 
     details::Node< T >* head;
@@ -380,8 +381,6 @@ void sukacheva::List< T >::swap(List& other) noexcept
   tail = other.tail;
   other.head = temp_head;
   other.tail = temp_tail;
-  delete temp_head;
-  delete temp_tail;
 }
 
 template< typename T >
@@ -391,12 +390,12 @@ sukacheva::List< T >::~List()
 }
 
 template< typename T >
-sukacheva::List< T >::List(const List&) :
+sukacheva::List< T >::List(const List& other) :
   head(nullptr),
   tail(nullptr),
   listSize(0)
 {
-  Iterator it = begin();
+  ConstIterator it = other.cbegin();
   while (it.node) {
     this->pushBack(it.node->data);
     ++it;
@@ -414,6 +413,28 @@ sukacheva::List< T >::List(List&& other):
   other.listSize = 0;
 }
 
+template< typename T >
+sukacheva::List< T >& sukacheva::List< T >::operator=(const List& other)
+{
+  if (this != &other)
+  {
+    List temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename T >
+sukacheva::List< T >& sukacheva::List< T >::operator=(List&& other) noexcept
+{
+  if (this != &other)
+  {
+    List temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
 template< typename T >
 sukacheva::List< T >::List(size_t count, const T& value) : List()
 {
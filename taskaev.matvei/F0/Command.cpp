@@ -18,7 +18,8 @@ void taskaev::HuffmanApp::showHelp()
     << "stats - Show frequency table\n"
     << "print - Show encoded text\n"
     << "output <filename> - Save encoded text\n"
-    << "merge <file1> <file2> - Merge two files\n";
+    << "merge <file1> <file2> - Merge two files\n"
+    << "decode <filename> - Decode text from file\n";
 }
 
 void taskaev::HuffmanApp::input()
@@ -61,7 +62,7 @@ void taskaev::HuffmanApp::encode()
     return;
   }
   tree_.build(text_);
-  encodedText_ = tree_.encode(text_);
+  encodedText_ = tree_.encode(text_, encodedBits_);
 }
 
 void taskaev::HuffmanApp::data()
@@ -76,7 +77,12 @@ void taskaev::HuffmanApp::showEncoded()
     std::cerr << "Error: No encoded data to display\n";
     return;
   }
-  std::cout << "Encoded text: " << encodedText_ << '\n';
+  std::cout << "Encoded text: ";
+  for (size_t i = 0; i < encodedBits_; ++i)
+  {
+    std::cout << ((static_cast< unsigned char >(encodedText_[i / 8]) >> (7 - i % 8)) & 1);
+  }
+  std::cout << '\n';
 }
 
 void taskaev::HuffmanApp::saveEncoded()
@@ -84,13 +90,18 @@ void taskaev::HuffmanApp::saveEncoded()
   std::string filename;
   std::cin >> filename;
   std::cin.ignore();
-  std::ofstream outFile(filename);
+  if (encodedText_.empty())
+  {
+    std::cerr << "Error: No encoded data to save\n";
+    return;
+  }
+  std::ofstream outFile(filename, std::ios::binary);
   if (!outFile)
   {
     std::cerr << "Error: Cannot open file " << filename << "\n";
     return;
   }
-  outFile << encodedText_;
+  writeEncoded(outFile, tree_, encodedText_, encodedBits_);
 }
 
 void taskaev::HuffmanApp::saveCodeTable()
@@ -117,15 +128,15 @@ void taskaev::HuffmanApp::mergeFiles()
   std::string filenameOne, filenameTwo;
   std::cin >> filenameOne >> filenameTwo;
   std::cin.ignore();
-  std::ifstream fileOne(filenameOne);
-  std::ifstream fileTwo(filenameTwo);
+  std::ifstream fileOne(filenameOne, std::ios::binary);
+  std::ifstream fileTwo(filenameTwo, std::ios::binary);
   if (!fileOne || !fileTwo)
   {
     std::cerr << "Error: Cannot open one of the files " << filenameOne << " or " << filenameTwo << "\n";
     return;
   }
   std::string mergeFilename = "merge_" + filenameOne + "_" + filenameTwo;
-  std::ofstream outFile(mergeFilename);
+  std::ofstream outFile(mergeFilename, std::ios::binary);
   if (!outFile)
   {
     std::cerr << "Error: Cannot create file " << mergeFilename << "\n";
@@ -134,3 +145,25 @@ void taskaev::HuffmanApp::mergeFiles()
   outFile << fileOne.rdbuf() << fileTwo.rdbuf();
 }
 
+void taskaev::HuffmanApp::decode()
+{
+  std::string filename;
+  std::cin >> filename;
+  std::cin.ignore();
+  std::ifstream inFile(filename, std::ios::binary);
+  if (!inFile)
+  {
+    std::cerr << "Error: Cannot open file " << filename << "\n";
+    return;
+  }
+  std::string decoded;
+  if (!readEncoded(inFile, decoded))
+  {
+    std::cerr << "Error: Invalid encoded file " << filename << "\n";
+    return;
+  }
+  text_ = decoded;
+  encodedText_.clear();
+  encodedBits_ = 0;
+  std::cout << "Decoded text: " << text_ << '\n';
+}
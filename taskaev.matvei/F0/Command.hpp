@@ -20,9 +20,11 @@ namespace taskaev
     void saveCodeTable();
     void showFreq();
     void mergeFiles();
+    void decode();
   private:
     std::string text_;
     std::string encodedText_;
+    size_t encodedBits_ = 0;
     HuffmanTree tree_;
   };
 }
@@ -1,9 +1,58 @@
 #include <string>
+#include <algorithm>
 #include <cstdlib>
+#include <istream>
+#include <ostream>
 #include "HuffmanTree.hpp"
 
+constexpr size_t taskaev::HuffmanTree::maxLength;
+
+namespace
+{
+  const char magic[] = { 'H', 'C' };
+  constexpr size_t sparseLimit = 85;
+
+  void writeVarint(std::ostream& out, unsigned long long value)
+  {
+    while (value >= 0x80)
+    {
+      out.put(static_cast< char >((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.put(static_cast< char >(value));
+  }
+
+  bool readVarint(std::istream& in, unsigned long long& value)
+  {
+    value = 0;
+    for (size_t shift = 0; shift < 64; shift += 7)
+    {
+      int byte = in.get();
+      if (byte == std::istream::traits_type::eof())
+      {
+        return false;
+      }
+      value |= static_cast< unsigned long long >(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+}
+
+taskaev::HuffmanTree::HuffmanTree():
+  freq_(),
+  codes_(),
+  symbols_(),
+  counts_(),
+  symbolCount_(0)
+{}
+
 void taskaev::HuffmanTree::build(const std::string& text)
 {
+  freq_.clear();
   for (char c : text)
   {
     freq_[c]++;
@@ -24,11 +73,60 @@ void taskaev::HuffmanTree::build(const std::string& text)
     nodes.pushBack(new Node('\0', left->freq_ + right->freq_, left, right));
   }
 
-  root_ = nodes.front();
-  genCode(root_, "");
+  unsigned char lengths[256] = {};
+  if (nodes.getSize() != 0)
+  {
+    genLength(nodes.front(), 0, lengths);
+    freeTree(nodes.front());
+  }
+  limitLength(lengths);
+  assign(lengths);
+}
+
+bool taskaev::HuffmanTree::assign(const unsigned char* lengths)
+{
+  symbolCount_ = 0;
+  for (size_t i = 0; i <= maxLength; ++i)
+  {
+    counts_[i] = 0;
+  }
+  for (size_t i = 0; i < 256; ++i)
+  {
+    codes_[i] = { 0, 0 };
+  }
+  for (size_t len = 1; len <= maxLength; ++len)
+  {
+    for (size_t i = 0; i < 256; ++i)
+    {
+      if (lengths[i] == len)
+      {
+        symbols_[symbolCount_++] = static_cast< unsigned char >(i);
+        counts_[len]++;
+      }
+    }
+  }
+
+  unsigned long long next[maxLength + 1] = {};
+  unsigned long long code = 0;
+  for (size_t len = 1; len <= maxLength; ++len)
+  {
+    code = (code + counts_[len - 1]) << 1;
+    next[len] = code;
+    if (code + counts_[len] > (1ULL << len))
+    {
+      symbolCount_ = 0;
+      return false;
+    }
+  }
+  for (size_t i = 0; i < symbolCount_; ++i)
+  {
+    size_t len = lengths[symbols_[i]];
+    codes_[symbols_[i]] = { next[len]++, len };
+  }
+  return true;
 }
 
-void taskaev::HuffmanTree::genCode(Node* node, const std::string& code)
+void taskaev::HuffmanTree::genLength(Node* node, size_t depth, unsigned char* lengths)
 {
   if (!node)
   {
@@ -36,22 +134,125 @@ void taskaev::HuffmanTree::genCode(Node* node, const std::string& code)
   }
   if (!node->left_ && !node->right_)
   {
-    codes_[node->symbol_] = code.empty() ? "1" : code;
+    size_t len = depth == 0 ? 1 : std::min(depth, size_t(255));
+    lengths[static_cast< unsigned char >(node->symbol_)] = static_cast< unsigned char >(len);
   }
-  genCode(node->left_, code + "0");
-  genCode(node->right_, code + "1");
+  genLength(node->left_, depth + 1, lengths);
+  genLength(node->right_, depth + 1, lengths);
 }
 
-std::string taskaev::HuffmanTree::encode(const std::string& text)
+void taskaev::HuffmanTree::limitLength(unsigned char* lengths)
+{
+  unsigned long long kraft = 0;
+  for (size_t i = 0; i < 256; ++i)
+  {
+    if (lengths[i] > maxLength)
+    {
+      lengths[i] = maxLength;
+    }
+    if (lengths[i] != 0)
+    {
+      kraft += 1ULL << (maxLength - lengths[i]);
+    }
+  }
+  while (kraft > (1ULL << maxLength))
+  {
+    size_t deepest = 0;
+    size_t deepestLength = 0;
+    for (size_t i = 0; i < 256; ++i)
+    {
+      if (lengths[i] < maxLength && lengths[i] > deepestLength)
+      {
+        deepest = i;
+        deepestLength = lengths[i];
+      }
+    }
+    lengths[deepest]++;
+    kraft -= 1ULL << (maxLength - lengths[deepest]);
+  }
+}
+
+void taskaev::HuffmanTree::freeTree(Node* node)
+{
+  if (!node)
+  {
+    return;
+  }
+  freeTree(node->left_);
+  freeTree(node->right_);
+  delete node;
+}
+
+std::string taskaev::HuffmanTree::encode(const std::string& text, size_t& bitCount) const
 {
   std::string encoded;
+  encoded.reserve(text.size());
+  unsigned long long acc = 0;
+  size_t count = 0;
+  bitCount = 0;
   for (char c : text)
   {
-    encoded += codes_[c];
+    const Code& code = codes_[static_cast< unsigned char >(c)];
+    acc = (acc << code.length) | code.bits;
+    count += code.length;
+    bitCount += code.length;
+    while (count >= 8)
+    {
+      count -= 8;
+      encoded += static_cast< char >(acc >> count);
+    }
+  }
+  if (count != 0)
+  {
+    encoded += static_cast< char >(acc << (8 - count));
   }
   return encoded;
 }
 
+bool taskaev::HuffmanTree::decode(const std::string& payload, size_t bitCount, std::string& text) const
+{
+  if (bitCount > payload.size() * 8)
+  {
+    return false;
+  }
+  size_t pos = 0;
+  while (pos < bitCount)
+  {
+    unsigned long long code = 0;
+    unsigned long long first = 0;
+    size_t index = 0;
+    bool found = false;
+    for (size_t len = 1; len <= maxLength && pos < bitCount && !found; ++len)
+    {
+      code |= (static_cast< unsigned char >(payload[pos / 8]) >> (7 - pos % 8)) & 1;
+      ++pos;
+      if (code - first < counts_[len])
+      {
+        text += static_cast< char >(symbols_[index + code - first]);
+        found = true;
+      }
+      index += counts_[len];
+      first = (first + counts_[len]) << 1;
+      code <<= 1;
+    }
+    if (!found)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t taskaev::HuffmanTree::getLength(char symbol) const
+{
+  return codes_[static_cast< unsigned char >(symbol)].length;
+}
+
+size_t taskaev::HuffmanTree::getSymbolCount() const
+{
+  return symbolCount_;
+}
+
 void taskaev::HuffmanTree::freqTable(std::ostream& out) {
   for (const auto& kv : freq_)
   {
@@ -60,9 +261,128 @@ void taskaev::HuffmanTree::freqTable(std::ostream& out) {
 }
 
 void taskaev::HuffmanTree::codeTable(std::ostream& out) {
-  for (const auto& kv : codes_)
+  for (const auto& kv : freq_)
   {
-    out << kv.first << ": " << kv.second << '\n';
+    const Code& code = codes_[static_cast< unsigned char >(kv.first)];
+    out << kv.first << ": ";
+    for (size_t i = code.length; i > 0; --i)
+    {
+      out << ((code.bits >> (i - 1)) & 1);
+    }
+    out << '\n';
   }
 }
 
+void taskaev::writeEncoded(std::ostream& out, const HuffmanTree& tree, const std::string& payload, size_t bitCount)
+{
+  const size_t count = tree.getSymbolCount();
+  out.write(magic, sizeof(magic));
+  out.put(static_cast< char >(count - 1));
+  if (count <= sparseLimit)
+  {
+    unsigned char nibbles[sparseLimit] = {};
+    size_t written = 0;
+    for (size_t i = 0; i < 256; ++i)
+    {
+      size_t len = tree.getLength(static_cast< char >(i));
+      if (len != 0)
+      {
+        out.put(static_cast< char >(i));
+        nibbles[written++] = static_cast< unsigned char >(len);
+      }
+    }
+    for (size_t i = 0; i < count; i += 2)
+    {
+      out.put(static_cast< char >((nibbles[i] << 4) | (i + 1 < count ? nibbles[i + 1] : 0)));
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < 256; i += 2)
+    {
+      size_t high = tree.getLength(static_cast< char >(i));
+      size_t low = tree.getLength(static_cast< char >(i + 1));
+      out.put(static_cast< char >((high << 4) | low));
+    }
+  }
+  writeVarint(out, bitCount);
+  out.write(payload.data(), payload.size());
+}
+
+bool taskaev::readEncoded(std::istream& in, std::string& text)
+{
+  bool any = false;
+  while (in.peek() != std::istream::traits_type::eof())
+  {
+    char header[sizeof(magic)] = {};
+    if (!in.read(header, sizeof(magic)) || header[0] != magic[0] || header[1] != magic[1])
+    {
+      return false;
+    }
+    int countByte = in.get();
+    if (countByte == std::istream::traits_type::eof())
+    {
+      return false;
+    }
+    const size_t count = static_cast< size_t >(countByte) + 1;
+
+    unsigned char lengths[256] = {};
+    if (count <= sparseLimit)
+    {
+      unsigned char symbols[sparseLimit] = {};
+      for (size_t i = 0; i < count; ++i)
+      {
+        int symbol = in.get();
+        if (symbol == std::istream::traits_type::eof())
+        {
+          return false;
+        }
+        symbols[i] = static_cast< unsigned char >(symbol);
+      }
+      for (size_t i = 0; i < count; i += 2)
+      {
+        int byte = in.get();
+        if (byte == std::istream::traits_type::eof())
+        {
+          return false;
+        }
+        lengths[symbols[i]] = static_cast< unsigned char >(byte >> 4);
+        if (i + 1 < count)
+        {
+          lengths[symbols[i + 1]] = static_cast< unsigned char >(byte & 0x0F);
+        }
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < 256; i += 2)
+      {
+        int byte = in.get();
+        if (byte == std::istream::traits_type::eof())
+        {
+          return false;
+        }
+        lengths[i] = static_cast< unsigned char >(byte >> 4);
+        lengths[i + 1] = static_cast< unsigned char >(byte & 0x0F);
+      }
+    }
+
+    unsigned long long bitCount = 0;
+    if (!readVarint(in, bitCount))
+    {
+      return false;
+    }
+    std::string payload((bitCount + 7) / 8, '\0');
+    if (!in.read(&payload[0], payload.size()))
+    {
+      return false;
+    }
+    HuffmanTree tree;
+    if (!tree.assign(lengths) || !tree.decode(payload, bitCount, text))
+    {
+      return false;
+    }
+    any = true;
+  }
+  return any;
+}
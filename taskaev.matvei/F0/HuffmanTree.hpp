@@ -8,11 +8,24 @@
 
 namespace taskaev
 {
+  struct Code
+  {
+    unsigned long long bits;
+    size_t length;
+  };
+
   class HuffmanTree
   {
   public:
+    static constexpr size_t maxLength = 15;
+
+    HuffmanTree();
     void build(const std::string& text);
-    std::string encode(const std::string& text);
+    bool assign(const unsigned char* lengths);
+    std::string encode(const std::string& text, size_t& bitCount) const;
+    bool decode(const std::string& payload, size_t bitCount, std::string& text) const;
+    size_t getLength(char symbol) const;
+    size_t getSymbolCount() const;
     void freqTable(std::ostream& out);
     void codeTable(std::ostream& out);
   private:
@@ -36,11 +49,18 @@ namespace taskaev
         return left->freq_ > right->freq_;
       }
     };
-    void genCode(Node* node, const std::string& code);
-    Node* root_;
+    void genLength(Node* node, size_t depth, unsigned char* lengths);
+    void limitLength(unsigned char* lengths);
+    void freeTree(Node* node);
     BSTree<char, int> freq_;
-    BSTree<char, std::string> codes_;
+    Code codes_[256];
+    unsigned char symbols_[256];
+    size_t counts_[maxLength + 1];
+    size_t symbolCount_;
   };
+
+  void writeEncoded(std::ostream& out, const HuffmanTree& tree, const std::string& payload, size_t bitCount);
+  bool readEncoded(std::istream& in, std::string& text);
 }
 
 #endif
@@ -20,6 +20,7 @@ int main()
   cmds["output"] = std::bind(&taskaev::HuffmanApp::saveEncoded, &app);
   cmds["table"] = std::bind(&taskaev::HuffmanApp::saveCodeTable, &app);
   cmds["merge"] = std::bind(&taskaev::HuffmanApp::mergeFiles, &app);
+  cmds["decode"] = std::bind(&taskaev::HuffmanApp::decode, &app);
   std::string command;
   while (true)
   {
@@ -1,28 +1,51 @@
 #include "commands.hpp"
 #include "keyValueSum.hpp"
 #include <string>
+#include <stdexcept>
 
-void zheleznyakov::commands::ascending(std::ostream & out, const data_t & data)
+void zheleznyakov::commands::ascending(std::istream &, std::ostream & out, const data_t & data)
 {
   KeyValueSum kvSum;
   kvSum = data.ctraverseLnR(kvSum);
   out << kvSum.getKeySum() << kvSum.getValueSum() << '\n';
 }
 
-void zheleznyakov::commands::descending(std::ostream & out, const data_t & data)
+void zheleznyakov::commands::descending(std::istream &, std::ostream & out, const data_t & data)
 {
   KeyValueSum kvSum;
   kvSum = data.ctraverseRnL(kvSum);
   out << kvSum.getKeySum() << kvSum.getValueSum() << '\n';
 }
 
-void zheleznyakov::commands::breadth(std::ostream & out, const data_t & data)
+void zheleznyakov::commands::breadth(std::istream &, std::ostream & out, const data_t & data)
 {
   KeyValueSum kvSum;
   kvSum = data.ctraverseBreadth(kvSum);
   out << kvSum.getKeySum() << kvSum.getValueSum() << '\n';
 }
 
+void zheleznyakov::commands::sum(std::istream & in, std::ostream & out, const data_t & data)
+{
+  long long low = 0;
+  long long high = 0;
+  if (!(in >> low >> high))
+  {
+    throw std::invalid_argument("Wrong range");
+  }
+  out << (low > high ? 0 : data.rangeSum(low, high)) << '\n';
+}
+
+void zheleznyakov::commands::kth(std::istream & in, std::ostream & out, const data_t & data)
+{
+  size_t k = 0;
+  if (!(in >> k) || k == 0 || k > data.getSize())
+  {
+    throw std::out_of_range("Wrong index");
+  }
+  data_t::ConstIterator it = data.select(k - 1);
+  out << it->first << ' ' << it->second << '\n';
+}
+
 void zheleznyakov::outInvalidCommand(std::ostream & out)
 {
   out << "<INVALID COMMAND>\n";
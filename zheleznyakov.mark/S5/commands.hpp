@@ -8,9 +8,11 @@ namespace zheleznyakov
 {
   namespace commands
   {
-    void ascending(std::ostream &, const data_t &);
-    void descending(std::ostream &, const data_t &);
-    void breadth(std::ostream &, const data_t &);
+    void ascending(std::istream &, std::ostream &, const data_t &);
+    void descending(std::istream &, std::ostream &, const data_t &);
+    void breadth(std::istream &, std::ostream &, const data_t &);
+    void sum(std::istream &, std::ostream &, const data_t &);
+    void kth(std::istream &, std::ostream &, const data_t &);
   }
 
   void outInvalidCommand(std::ostream &);
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <tree.hpp>
 #include "input.hpp"
 #include "commands.hpp"
@@ -8,13 +9,26 @@ int main(int argc, char * argv[])
 {
   using namespace zheleznyakov;
 
-  if (argc != 3)
+  if (argc < 3)
   {
     std::cerr << "Wrong arguments count\n";
     return 2;
   }
 
-  std::ifstream in(argv[2]);
+  std::string command = argv[1];
+  int paramsCount = (command == "sum") ? 2 : ((command == "kth") ? 1 : 0);
+  if (argc != 3 + paramsCount)
+  {
+    std::cerr << "Wrong arguments count\n";
+    return 2;
+  }
+  std::stringstream params;
+  for (int i = 2; i < argc - 1; ++i)
+  {
+    params << argv[i] << ' ';
+  }
+
+  std::ifstream in(argv[argc - 1]);
   if (!in)
   {
     std::cerr << "Unable to read file\n";
@@ -32,15 +46,16 @@ int main(int argc, char * argv[])
     return 0;
   }
 
-  Tree< std::string, std::function< void(std::ostream &, const data_t &) > > cmds;
+  Tree< std::string, std::function< void(std::istream &, std::ostream &, const data_t &) > > cmds;
   cmds["ascending"] = commands::ascending;
   cmds["descending"] = commands::descending;
   cmds["breadth"] = commands::breadth;
-  std::string command = argv[1];
+  cmds["sum"] = commands::sum;
+  cmds["kth"] = commands::kth;
 
   try
   {
-    cmds.at(command)(std::cout, data);
+    cmds.at(command)(params, std::cout, data);
   }
   catch(const std::exception &)
   {
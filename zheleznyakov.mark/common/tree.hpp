@@ -3,11 +3,63 @@
 #include <utility>
 #include <stdexcept>
 #include <functional>
+#include <limits>
+#include <type_traits>
 #include <stack.hpp>
 #include <queue.hpp>
 
 namespace zheleznyakov
 {
+  namespace details
+  {
+    template < typename Key, bool = std::is_integral< Key >::value >
+    struct KeySum
+    {
+      KeySum():
+        value(0),
+        overflow(false)
+      {}
+
+      static bool add(Key & sum, const Key & key)
+      {
+        if (key > 0 && sum > std::numeric_limits< Key >::max() - key)
+        {
+          return false;
+        }
+        if (key < 0 && sum < std::numeric_limits< Key >::min() - key)
+        {
+          return false;
+        }
+        sum += key;
+        return true;
+      }
+
+      void assign(const Key & key, const KeySum * left, const KeySum * right)
+      {
+        value = key;
+        overflow = false;
+        if (left != nullptr)
+        {
+          overflow = left->overflow || !add(value, left->value);
+        }
+        if (right != nullptr)
+        {
+          overflow = overflow || right->overflow || !add(value, right->value);
+        }
+      }
+
+      Key value;
+      bool overflow;
+    };
+
+    template < typename Key >
+    struct KeySum< Key, false >
+    {
+      void assign(const Key &, const KeySum *, const KeySum *)
+      {}
+    };
+  }
+
   template < typename Key, typename Value, typename Compare = std::less< Key > >
   class Tree
   {
@@ -32,6 +84,8 @@ namespace zheleznyakov
     size_t getSize() const;
     bool empty() const noexcept;
     size_t count(const Key &) const;
+    size_t rank(const Key &) const;
+    Key rangeSum(const Key &, const Key &) const;
 
     Value at(const Key &);
     void insert(const Key &, const Value &);
@@ -51,6 +105,8 @@ namespace zheleznyakov
 
     Iterator find(const Key &);
     ConstIterator find(const Key &) const;
+    Iterator select(size_t);
+    ConstIterator select(size_t) const;
 
     std::pair< Iterator, Iterator > equalRange(const Key &, const Key &);
 
@@ -78,7 +134,8 @@ namespace zheleznyakov
         parent(newParent),
         left(newLeft),
         right(newRight),
-        height(1)
+        height(1),
+        size(1)
       {}
       ~Node() = default;
 
@@ -87,11 +144,17 @@ namespace zheleznyakov
       Node * left;
       Node * right;
       size_t height;
+      size_t size;
+      details::KeySum< Key > keySum;
     };
 
     Node * root_;
 
-    size_t size(Node *) const;
+    size_t size(const Node *) const noexcept;
+    void update(Node *);
+    void rebalanceUp(Node *);
+    Node * selectNode(size_t) const;
+    void addSubtree(Key &, const Node *) const;
     void clear(Node *);
     size_t getHeight(Node *);
     int getBalance(Node *);
@@ -155,7 +218,12 @@ zheleznyakov::Tree< Key, Value, Compare > & zheleznyakov::Tree< Key, Value, Comp
   if (&other != this)
   {
     clear(root_);
+    root_ = nullptr;
     Node * node_ = other.root_;
+    while (node_ != nullptr && node_->left != nullptr)
+    {
+      node_ = node_->left;
+    }
     while (node_ != nullptr)
     {
       insert(node_->data.first, node_->data.second);
@@ -404,9 +472,9 @@ typename zheleznyakov::Tree< Key, Value, Compare >::data_t * zheleznyakov::Tree<
 }
 
 template < typename Key, typename Value, typename Compare >
-size_t zheleznyakov::Tree< Key, Value, Compare >::size(Node* node) const
+size_t zheleznyakov::Tree< Key, Value, Compare >::size(const Node * node) const noexcept
 {
-  return node != nullptr ? 1 + size(node->left) + size(node->right) : 0;
+  return node != nullptr ? node->size : 0;
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -427,6 +495,93 @@ size_t zheleznyakov::Tree< Key, Value, Compare >::count(const Key & key) const
   return find(key) != cend() ? 1 : 0;
 }
 
+template < typename Key, typename Value, typename Compare >
+size_t zheleznyakov::Tree< Key, Value, Compare >::rank(const Key & key) const
+{
+  const Node * current = root_;
+  Compare cmp;
+  size_t result = 0;
+  while (current != nullptr)
+  {
+    if (cmp(current->data.first, key))
+    {
+      result += size(current->left) + 1;
+      current = current->right;
+    }
+    else
+    {
+      current = current->left;
+    }
+  }
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+Key zheleznyakov::Tree< Key, Value, Compare >::rangeSum(const Key & low, const Key & high) const
+{
+  Compare cmp;
+  Key result = Key();
+  const Node * split = root_;
+  while (split != nullptr && (cmp(split->data.first, low) || cmp(high, split->data.first)))
+  {
+    split = cmp(split->data.first, low) ? split->right : split->left;
+  }
+  if (split == nullptr)
+  {
+    return result;
+  }
+  if (!details::KeySum< Key >::add(result, split->data.first))
+  {
+    throw std::overflow_error("Key sum overflow");
+  }
+  for (const Node * current = split->left; current != nullptr;)
+  {
+    if (cmp(current->data.first, low))
+    {
+      current = current->right;
+    }
+    else
+    {
+      addSubtree(result, current->right);
+      if (!details::KeySum< Key >::add(result, current->data.first))
+      {
+        throw std::overflow_error("Key sum overflow");
+      }
+      current = current->left;
+    }
+  }
+  for (const Node * current = split->right; current != nullptr;)
+  {
+    if (cmp(high, current->data.first))
+    {
+      current = current->left;
+    }
+    else
+    {
+      addSubtree(result, current->left);
+      if (!details::KeySum< Key >::add(result, current->data.first))
+      {
+        throw std::overflow_error("Key sum overflow");
+      }
+      current = current->right;
+    }
+  }
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+void zheleznyakov::Tree< Key, Value, Compare >::addSubtree(Key & sum, const Node * node) const
+{
+  if (node == nullptr)
+  {
+    return;
+  }
+  if (node->keySum.overflow || !details::KeySum< Key >::add(sum, node->keySum.value))
+  {
+    throw std::overflow_error("Key sum overflow");
+  }
+}
+
 template < typename Key, typename Value, typename Compare >
 Value& zheleznyakov::Tree< Key, Value, Compare >::operator[](const Key& key)
 {
@@ -466,6 +621,8 @@ Value& zheleznyakov::Tree< Key, Value, Compare >::operator[](const Key& key)
   {
       parent->right = current;
   }
+  update(current);
+  rebalanceUp(parent);
 
   return current->data.second;
 }
@@ -524,6 +681,7 @@ void zheleznyakov::Tree< Key, Value, Compare >::insert(const Key& k, const Value
 
   Compare cmp;
 
+  update(new_node);
   if (root_ == nullptr)
   {
     root_ = new_node;
@@ -556,7 +714,7 @@ void zheleznyakov::Tree< Key, Value, Compare >::insert(const Key& k, const Value
     parent->right = new_node;
   }
 
-  root_ = balance(root_);
+  rebalanceUp(parent);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -609,6 +767,42 @@ typename zheleznyakov::Tree< Key, Value, Compare >::ConstIterator zheleznyakov::
   return ConstIterator(nullptr);
 }
 
+template < typename Key, typename Value, typename Compare >
+typename zheleznyakov::Tree< Key, Value, Compare >::Node * zheleznyakov::Tree< Key, Value, Compare >::selectNode(size_t index) const
+{
+  Node * current = root_;
+  while (current != nullptr)
+  {
+    size_t leftSize = size(current->left);
+    if (index < leftSize)
+    {
+      current = current->left;
+    }
+    else if (index == leftSize)
+    {
+      return current;
+    }
+    else
+    {
+      index -= leftSize + 1;
+      current = current->right;
+    }
+  }
+  return nullptr;
+}
+
+template < typename Key, typename Value, typename Compare >
+typename zheleznyakov::Tree< Key, Value, Compare >::Iterator zheleznyakov::Tree< Key, Value, Compare >::select(size_t index)
+{
+  return Iterator(selectNode(index));
+}
+
+template < typename Key, typename Value, typename Compare >
+typename zheleznyakov::Tree< Key, Value, Compare >::ConstIterator zheleznyakov::Tree< Key, Value, Compare >::select(size_t index) const
+{
+  return ConstIterator(selectNode(index));
+}
+
 template < typename Key, typename Value, typename Compare >
 typename zheleznyakov::Tree< Key, Value, Compare >::Iterator
 zheleznyakov::Tree< Key, Value, Compare >::find(const Key & low, const Key & high)
@@ -706,6 +900,7 @@ void zheleznyakov::Tree< Key, Value, Compare>::clear()
   if (!empty())
   {
     clear(root_);
+    root_ = nullptr;
   }
 }
 
@@ -740,8 +935,14 @@ typename zheleznyakov::Tree< Key, Value, Compare >::Node * zheleznyakov::Tree< K
   Node* T = x->right;
   x->right = y;
   y->left = T;
-  y->height = std::max(getHeight(y->left), getHeight(y->right)) + 1;
-  x->height = std::max(getHeight(x->left), getHeight(x->right)) + 1;
+  x->parent = y->parent;
+  y->parent = x;
+  if (T != nullptr)
+  {
+    T->parent = y;
+  }
+  update(y);
+  update(x);
   return x;
 }
 
@@ -752,8 +953,14 @@ typename zheleznyakov::Tree< Key, Value, Compare >::Node * zheleznyakov::Tree< K
   Node* T = y->left;
   y->left = x;
   x->right = T;
-  x->height = std::max(getHeight(x->left), getHeight(x->right)) + 1;
-  y->height = std::max(getHeight(y->left), getHeight(y->right)) + 1;
+  y->parent = x->parent;
+  x->parent = y;
+  if (T != nullptr)
+  {
+    T->parent = x;
+  }
+  update(x);
+  update(y);
   return y;
 }
 
@@ -764,6 +971,7 @@ typename zheleznyakov::Tree< Key, Value, Compare >::Node* zheleznyakov::Tree< Ke
   {
     return node;
   }
+  update(node);
   int balance = getBalance(node);
   if (balance > 1 && getBalance(node->left) >= 0)
   {
@@ -786,6 +994,41 @@ typename zheleznyakov::Tree< Key, Value, Compare >::Node* zheleznyakov::Tree< Ke
   return node;
 }
 
+template < typename Key, typename Value, typename Compare >
+void zheleznyakov::Tree< Key, Value, Compare >::update(Node * node)
+{
+  node->height = std::max(getHeight(node->left), getHeight(node->right)) + 1;
+  node->size = size(node->left) + size(node->right) + 1;
+  node->keySum.assign(
+    node->data.first,
+    node->left != nullptr ? &node->left->keySum : nullptr,
+    node->right != nullptr ? &node->right->keySum : nullptr
+  );
+}
+
+template < typename Key, typename Value, typename Compare >
+void zheleznyakov::Tree< Key, Value, Compare >::rebalanceUp(Node * node)
+{
+  while (node != nullptr)
+  {
+    Node * parent = node->parent;
+    Node * balanced = balance(node);
+    if (parent == nullptr)
+    {
+      root_ = balanced;
+    }
+    else if (parent->left == node)
+    {
+      parent->left = balanced;
+    }
+    else
+    {
+      parent->right = balanced;
+    }
+    node = parent;
+  }
+}
+
 template < typename Key, typename Value, typename Compare >
 typename zheleznyakov::Tree< Key, Value, Compare >::Iterator zheleznyakov::Tree< Key, Value, Compare >::begin() noexcept
 {
@@ -845,22 +1088,28 @@ typename zheleznyakov::Tree<Key, Value, Compare>::Node * zheleznyakov::Tree<Key,
   if (key < node->data.first)
   {
     node->left = eraseNode(node->left, key);
+    if (node->left != nullptr)
+    {
+      node->left->parent = node;
+    }
   }
   else if (key > node->data.first)
   {
     node->right = eraseNode(node->right, key);
+    if (node->right != nullptr)
+    {
+      node->right->parent = node;
+    }
   }
   else
   {
-    if (node->left == nullptr)
+    if (node->left == nullptr || node->right == nullptr)
     {
-      Node* temp = node->right;
-      delete node;
-      return temp;
-    }
-    else if (node->right == nullptr)
-    {
-      Node* temp = node->left;
+      Node* temp = node->left == nullptr ? node->right : node->left;
+      if (temp != nullptr)
+      {
+        temp->parent = node->parent;
+      }
       delete node;
       return temp;
     }
@@ -868,9 +1117,13 @@ typename zheleznyakov::Tree<Key, Value, Compare>::Node * zheleznyakov::Tree<Key,
     Node* temp = minValueNode(node->right);
     node->data = temp->data;
     node->right = eraseNode(node->right, temp->data.first);
+    if (node->right != nullptr)
+    {
+      node->right->parent = node;
+    }
   }
 
-  return node;
+  return balance(node);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -1,19 +1,9 @@
 #include <iostream>
 #include <fstream>
-#include <limits>
-#include <algorithm>
 #include <List.hpp>
 #include "Commands.hpp"
 #include "GraphUtils.hpp"
 
-void resetDijkstra(Graph &graph) {
-  graph.distances.clear();
-  graph.predecessors.clear();
-  for (const auto &pair: graph.adjList) {
-    graph.distances[pair.first] = std::numeric_limits< int >::max();
-  }
-}
-
 void dijkstraCommand(std::istream &input, std::ostream &output, Graph &graph) {
   std::string startVertex;
   input >> startVertex;
@@ -21,74 +11,28 @@ void dijkstraCommand(std::istream &input, std::ostream &output, Graph &graph) {
   if (graph.adjList.find(startVertex) == graph.adjList.end()) {
     output << "Vertex does not exist\n";
   }
-  else {
-    resetDijkstra(graph);
-    graph.distances[startVertex] = 0;
-
-    zhitnyj::List< std::string > vertices;
-    for (const auto &pair: graph.adjList) {
-      vertices.push_back(pair.first);
-    }
-
-    while (!vertices.empty()) {
-      std::string minVertex;
-      int minDistance = std::numeric_limits< int >::max();
-      for (auto it = vertices.begin(); it != vertices.end(); ++it) {
-        const std::string &vertex = *it;
-        if (graph.distances[vertex] < minDistance) {
-          minDistance = graph.distances[vertex];
-          minVertex = vertex;
-        }
-      }
-
-      if (minDistance == std::numeric_limits< int >::max()) {
-        break;
-      }
-
-      auto it = vertices.begin();
-      while (it != vertices.end()) {
-        if (*it == minVertex) {
-          vertices.erase(*it);
-          break;
-        }
-        ++it;
-      }
-
-      for (const auto &neighborWeightPair: graph.adjList[minVertex]) {
-        const std::string &neighbor = neighborWeightPair.first;
-        int weight = neighborWeightPair.second;
-
-        int distance = graph.distances[minVertex] + weight;
-        if (distance < graph.distances[neighbor]) {
-          graph.distances[neighbor] = distance;
-          graph.predecessors[neighbor] = minVertex;
-        }
-      }
-    }
+  else if (!graph.paths.isCached(startVertex)) {
+    graph.paths.run(graph.adjList, startVertex);
   }
 }
 
-void shortestPathCommand(std::istream &input, std::ostream &output, const Graph &graph) {
+void shortestPathCommand(std::istream &input, std::ostream &output, Graph &graph) {
   std::string startVertex, endVertex;
   input >> startVertex >> endVertex;
 
-  if (graph.distances.find(endVertex) == graph.distances.end()) {
+  if (graph.adjList.find(startVertex) == graph.adjList.end() || graph.adjList.find(endVertex) == graph.adjList.end()) {
     output << "One of the vertices doesn't exists\n";
+    return;
   }
-  else if (graph.distances.at(endVertex) == std::numeric_limits< int >::max()) {
+  if (!graph.paths.isCached(startVertex)) {
+    graph.paths.run(graph.adjList, startVertex);
+  }
+
+  if (!graph.paths.isReachable(endVertex)) {
     output << "No path between vertices\n";
   }
   else {
-    zhitnyj::List< std::string > path;
-    std::string current = endVertex;
-
-    while (current != startVertex) {
-      path.push_front(current);
-      current = graph.predecessors.at(current);
-    }
-    path.push_front(startVertex);
-
-    for (const auto &vertex: path) {
+    for (const auto &vertex: graph.paths.getPath(endVertex)) {
       output << vertex << " ";
     }
     output << "\n";
@@ -141,6 +85,7 @@ void loadGraphCommand(std::istream &input, std::ostream &output, Graph &graph) {
   }
 
   graph.adjList.clear();
+  graph.paths.invalidate();
   std::string line;
 
   while (std::getline(file, line)) {
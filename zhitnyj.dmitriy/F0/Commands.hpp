@@ -7,7 +7,7 @@
 
 void printInvalidCommand(std::ostream &output);
 void dijkstraCommand(std::istream &input, std::ostream &output, Graph &graph);
-void shortestPathCommand(std::istream &input, std::ostream &output, const Graph &graph);
+void shortestPathCommand(std::istream &input, std::ostream &output, Graph &graph);
 void saveGraphCommand(std::istream &input, std::ostream &output, const Graph &graph);
 void loadGraphCommand(std::istream &input, std::ostream &output, Graph &graph);
 void addCommand(std::istream &input, std::ostream &output, Graph &graph);
@@ -3,11 +3,11 @@
 
 #include <map>
 #include <string>
+#include "ShortestPaths.hpp"
 
 struct Graph {
   std::map< std::string, std::map< std::string, int > > adjList;
-  std::map< std::string, int > distances;
-  std::map< std::string, std::string > predecessors;
+  ShortestPaths paths;
 };
 
 #endif
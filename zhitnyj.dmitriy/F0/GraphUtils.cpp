@@ -7,6 +7,7 @@ void addVertex(Graph &graph, const std::string &vertex) {
     throw std::logic_error("Vertex already exists\n");
   }
   graph.adjList[vertex] = {};
+  graph.paths.invalidate();
 }
 
 void addEdge(Graph &graph, const std::string &vertex1, const std::string &vertex2, int weight) {
@@ -21,6 +22,7 @@ void addEdge(Graph &graph, const std::string &vertex1, const std::string &vertex
   }
   graph.adjList[vertex1][vertex2] = weight;
   graph.adjList[vertex2][vertex1] = weight;
+  graph.paths.invalidate();
 }
 
 void deleteVertex(Graph &graph, const std::string &vertex) {
@@ -32,6 +34,7 @@ void deleteVertex(Graph &graph, const std::string &vertex) {
     auto &edges = keyEdgesPair.second;
     edges.erase(vertex);
   }
+  graph.paths.invalidate();
 }
 
 void deleteEdge(Graph &graph, const std::string &vertex1, const std::string &vertex2) {
@@ -43,6 +46,7 @@ void deleteEdge(Graph &graph, const std::string &vertex1, const std::string &ver
   }
   graph.adjList[vertex1].erase(vertex2);
   graph.adjList[vertex2].erase(vertex1);
+  graph.paths.invalidate();
 }
 
 void updateEdge(Graph &graph, const std::string &vertex1, const std::string &vertex2, int newWeight) {
@@ -54,6 +58,7 @@ void updateEdge(Graph &graph, const std::string &vertex1, const std::string &ver
   }
   graph.adjList[vertex1][vertex2] = newWeight;
   graph.adjList[vertex2][vertex1] = newWeight;
+  graph.paths.invalidate();
 }
 
 void neighbors(const Graph &graph, const std::string &vertex, std::ostream &output) {
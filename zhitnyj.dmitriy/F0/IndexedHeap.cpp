@@ -0,0 +1,77 @@
+#include "IndexedHeap.hpp"
+
+const size_t IndexedHeap::npos = static_cast< size_t >(-1);
+
+IndexedHeap::IndexedHeap(size_t capacity):
+  heap_(),
+  positions_(capacity, npos),
+  keys_(capacity, 0) {
+  heap_.reserve(capacity);
+}
+
+bool IndexedHeap::empty() const noexcept {
+  return heap_.empty();
+}
+
+bool IndexedHeap::contains(size_t id) const noexcept {
+  return positions_[id] != npos;
+}
+
+void IndexedHeap::push(size_t id, long long key) {
+  keys_[id] = key;
+  heap_.push_back(id);
+  positions_[id] = heap_.size() - 1;
+  siftUp(heap_.size() - 1);
+}
+
+void IndexedHeap::decrease(size_t id, long long key) {
+  keys_[id] = key;
+  siftUp(positions_[id]);
+}
+
+size_t IndexedHeap::pop() {
+  size_t top = heap_.front();
+  positions_[top] = npos;
+  size_t last = heap_.back();
+  heap_.pop_back();
+  if (!heap_.empty()) {
+    place(0, last);
+    siftDown(0);
+  }
+  return top;
+}
+
+void IndexedHeap::siftUp(size_t index) {
+  size_t id = heap_[index];
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (keys_[heap_[parent]] <= keys_[id]) {
+      break;
+    }
+    place(index, heap_[parent]);
+    index = parent;
+  }
+  place(index, id);
+}
+
+void IndexedHeap::siftDown(size_t index) {
+  size_t id = heap_[index];
+  size_t size = heap_.size();
+  while (2 * index + 1 < size) {
+    size_t child = 2 * index + 1;
+    if (child + 1 < size && keys_[heap_[child + 1]] < keys_[heap_[child]]) {
+      ++child;
+    }
+    if (keys_[id] <= keys_[heap_[child]]) {
+      break;
+    }
+    place(index, heap_[child]);
+    index = child;
+  }
+  place(index, id);
+}
+
+void IndexedHeap::place(size_t index, size_t id) {
+  heap_[index] = id;
+  positions_[id] = index;
+}
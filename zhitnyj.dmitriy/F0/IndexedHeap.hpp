@@ -0,0 +1,29 @@
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+
+#include <cstddef>
+#include <vector>
+
+class IndexedHeap {
+public:
+  explicit IndexedHeap(size_t capacity);
+
+  bool empty() const noexcept;
+  bool contains(size_t id) const noexcept;
+  void push(size_t id, long long key);
+  void decrease(size_t id, long long key);
+  size_t pop();
+
+private:
+  static const size_t npos;
+
+  void siftUp(size_t index);
+  void siftDown(size_t index);
+  void place(size_t index, size_t id);
+
+  std::vector< size_t > heap_;
+  std::vector< size_t > positions_;
+  std::vector< long long > keys_;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include "IndexedHeap.hpp"
+#include "ShortestPaths.hpp"
+
+const size_t ShortestPaths::npos = static_cast< size_t >(-1);
+const long long ShortestPaths::infinity = std::numeric_limits< long long >::max();
+
+ShortestPaths::ShortestPaths():
+  names_(),
+  offsets_(),
+  targets_(),
+  weights_(),
+  distances_(),
+  predecessors_(),
+  source_(npos),
+  snapshotValid_(false),
+  resultValid_(false) {}
+
+void ShortestPaths::invalidate() noexcept {
+  snapshotValid_ = false;
+  resultValid_ = false;
+}
+
+bool ShortestPaths::isCached(const std::string &source) const {
+  return resultValid_ && names_[source_] == source;
+}
+
+void ShortestPaths::run(const AdjList &adjList, const std::string &source) {
+  if (!snapshotValid_) {
+    snapshot(adjList);
+  }
+  size_t start = findId(source);
+  if (start == npos) {
+    throw std::logic_error("Vertex does not exist\n");
+  }
+
+  distances_.assign(names_.size(), infinity);
+  predecessors_.assign(names_.size(), npos);
+  distances_[start] = 0;
+
+  IndexedHeap heap(names_.size());
+  heap.push(start, 0);
+  while (!heap.empty()) {
+    size_t current = heap.pop();
+    long long base = distances_[current];
+    for (size_t i = offsets_[current]; i < offsets_[current + 1]; ++i) {
+      size_t neighbor = targets_[i];
+      long long distance = base + weights_[i];
+      if (distance < distances_[neighbor]) {
+        bool queued = distances_[neighbor] != infinity;
+        distances_[neighbor] = distance;
+        predecessors_[neighbor] = current;
+        if (!queued) {
+          heap.push(neighbor, distance);
+        }
+        else if (heap.contains(neighbor)) {
+          heap.decrease(neighbor, distance);
+        }
+      }
+    }
+  }
+
+  source_ = start;
+  resultValid_ = true;
+}
+
+bool ShortestPaths::isReachable(const std::string &vertex) const {
+  size_t id = findId(vertex);
+  return resultValid_ && id != npos && distances_[id] != infinity;
+}
+
+long long ShortestPaths::getDistance(const std::string &vertex) const {
+  size_t id = findId(vertex);
+  if (!resultValid_ || id == npos) {
+    throw std::logic_error("Vertex does not exist\n");
+  }
+  return distances_[id];
+}
+
+std::vector< std::string > ShortestPaths::getPath(const std::string &vertex) const {
+  std::vector< std::string > path;
+  if (!isReachable(vertex)) {
+    return path;
+  }
+  for (size_t id = findId(vertex); id != npos; id = predecessors_[id]) {
+    path.push_back(names_[id]);
+  }
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+void ShortestPaths::snapshot(const AdjList &adjList) {
+  names_.clear();
+  names_.reserve(adjList.size());
+  size_t edgeCount = 0;
+  for (const auto &vertexEdgesPair: adjList) {
+    names_.push_back(vertexEdgesPair.first);
+    edgeCount += vertexEdgesPair.second.size();
+  }
+
+  offsets_.assign(1, 0);
+  offsets_.reserve(names_.size() + 1);
+  targets_.clear();
+  targets_.reserve(edgeCount);
+  weights_.clear();
+  weights_.reserve(edgeCount);
+  for (const auto &vertexEdgesPair: adjList) {
+    for (const auto &neighborWeightPair: vertexEdgesPair.second) {
+      size_t neighbor = findId(neighborWeightPair.first);
+      if (neighbor != npos) {
+        targets_.push_back(neighbor);
+        weights_.push_back(neighborWeightPair.second);
+      }
+    }
+    offsets_.push_back(targets_.size());
+  }
+
+  snapshotValid_ = true;
+  resultValid_ = false;
+}
+
+size_t ShortestPaths::findId(const std::string &vertex) const {
+  auto it = std::lower_bound(names_.begin(), names_.end(), vertex);
+  if (it == names_.end() || *it != vertex) {
+    return npos;
+  }
+  return static_cast< size_t >(it - names_.begin());
+}
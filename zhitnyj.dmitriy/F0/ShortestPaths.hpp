@@ -0,0 +1,40 @@
+#ifndef SHORTESTPATHS_HPP
+#define SHORTESTPATHS_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+class ShortestPaths {
+public:
+  using AdjList = std::map< std::string, std::map< std::string, int > >;
+
+  ShortestPaths();
+
+  void invalidate() noexcept;
+  bool isCached(const std::string &source) const;
+  void run(const AdjList &adjList, const std::string &source);
+
+  bool isReachable(const std::string &vertex) const;
+  long long getDistance(const std::string &vertex) const;
+  std::vector< std::string > getPath(const std::string &vertex) const;
+
+private:
+  static const size_t npos;
+  static const long long infinity;
+
+  void snapshot(const AdjList &adjList);
+  size_t findId(const std::string &vertex) const;
+
+  std::vector< std::string > names_;
+  std::vector< size_t > offsets_;
+  std::vector< size_t > targets_;
+  std::vector< int > weights_;
+  std::vector< long long > distances_;
+  std::vector< size_t > predecessors_;
+  size_t source_;
+  bool snapshotValid_;
+  bool resultValid_;
+};
+
+#endif
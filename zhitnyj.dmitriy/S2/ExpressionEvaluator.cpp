@@ -1,11 +1,37 @@
 #include <limits>
 #include <stdexcept>
 #include <memory>
+#include <utility>
 #include <cmath>
 #include <string>
 #include <cctype>
 #include "ExpressionEvaluator.hpp"
 
+zhitnyj::ExpressionEvaluator::ExpressionEvaluator(size_t cacheCapacity):
+  cacheCapacity_(cacheCapacity),
+  cache_(),
+  stack_()
+{}
+
+long long zhitnyj::ExpressionEvaluator::evaluate(const std::string& ep)
+{
+  auto cached = cache_.find(ep);
+  if (cached != cache_.end())
+  {
+    return cached->second.run(stack_);
+  }
+  Program program = Program::compile(ep);
+  if (cacheCapacity_ == 0)
+  {
+    return program.run(stack_);
+  }
+  if (cache_.size() >= cacheCapacity_)
+  {
+    cache_.clear();
+  }
+  return cache_.emplace(ep, std::move(program)).first->second.run(stack_);
+}
+
 void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > >& qe, const std::string& ep)
 {
   std::string token;
@@ -136,19 +162,6 @@ long long zhitnyj::ExpressionEvaluator::evaluateExpression(zhitnyj::Queue< std::
       evaluationStack.pop();
       long long left = evaluationStack.top();
       evaluationStack.pop();
-      bool add_overflow = op->getOperator() == '+' && (left > (std::numeric_limits< long long >::max() - right));
-      bool multiply_overflow = op->getOperator() == '*' && (std::abs(left) > (std::numeric_limits< long long >::max() / right));
-      bool minus_overflow = op->getOperator() == '-' && (left < (std::numeric_limits< long long >::min() + right));
-      bool divide_overflow = op->getOperator() == '/' && ((left == std::numeric_limits< long long >::min()) && right == -1);
-
-      if (add_overflow || multiply_overflow)
-      {
-        throw std::overflow_error("There was an overflow error!");
-      }
-      else if (minus_overflow || divide_overflow)
-      {
-        throw std::overflow_error("There was an underflow error!");
-      }
       long long result = op->applyOp(left, right);
       evaluationStack.push(result);
     }
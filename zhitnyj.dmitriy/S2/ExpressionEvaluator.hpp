@@ -1,23 +1,34 @@
 #ifndef EXPRESSION_EVALUATOR_HPP
 #define EXPRESSION_EVALUATOR_HPP
 
+#include <cstddef>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <Queue.hpp>
 #include <Stack.hpp>
 #include "ExpressionItem.hpp"
 #include "Operand.hpp"
 #include "Operator.hpp"
+#include "Program.hpp"
 
 namespace zhitnyj {
   class ExpressionEvaluator
   {
   public:
-    ExpressionEvaluator() = default;
+    explicit ExpressionEvaluator(size_t cacheCapacity = 4096);
     ~ExpressionEvaluator() = default;
 
+    long long evaluate(const std::string& ep);
+
     static void parseExpression(Queue< std::shared_ptr< ExpressionItem > >& qe, const std::string& ep);
     static Queue< std::shared_ptr< ExpressionItem > > toPostfix(Queue< std::shared_ptr< ExpressionItem > >& inQe);
     static long long evaluateExpression(Queue< std::shared_ptr< ExpressionItem > >& postfixQueue);
+
+  private:
+    size_t cacheCapacity_;
+    std::unordered_map< std::string, Program > cache_;
+    std::vector< long long > stack_;
   };
 }
 
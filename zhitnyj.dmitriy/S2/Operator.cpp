@@ -1,4 +1,5 @@
 #include "Operator.hpp"
+#include <limits>
 
 zhitnyj::Operator::Operator(char op) : operator_(op)
 {
@@ -45,42 +46,7 @@ int zhitnyj::Operator::precedence() const
 
 long long zhitnyj::Operator::applyOp(long long a, long long b) const
 {
-  if (operator_ == '+')
-  {
-    return a + b;
-  }
-  else if (operator_ == '-')
-  {
-    return a - b;
-  }
-  else if (operator_ == '*')
-  {
-    return a * b;
-  }
-  else if (operator_ == '/')
-  {
-    if (b == 0)
-    {
-      throw std::runtime_error("Division by zero");
-    }
-    return a / b;
-  }
-  else if (operator_ == '%')
-  {
-    if (b == 0)
-    {
-      throw std::runtime_error("Modulo by zero");
-    }
-    if (a < 0)
-    {
-      return a % b + abs(b);
-    }
-    return a % b;
-  }
-  else
-  {
-    throw std::invalid_argument("Invalid operation");
-  }
+  return applyOperator(operator_, a, b);
 }
 
 bool zhitnyj::Operator::isOperator()
@@ -98,3 +64,65 @@ bool zhitnyj::Operator::isOperator(char c)
   return c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '(' || c == ')';
 }
 
+long long zhitnyj::applyOperator(char op, long long left, long long right)
+{
+  const long long max = std::numeric_limits< long long >::max();
+  const long long min = std::numeric_limits< long long >::min();
+  switch (op)
+  {
+  case '+':
+    if ((right > 0 && left > max - right) || (right < 0 && left < min - right))
+    {
+      throw std::overflow_error("There was an overflow error!");
+    }
+    return left + right;
+  case '-':
+    if ((right > 0 && left < min + right) || (right < 0 && left > max + right))
+    {
+      throw std::overflow_error("There was an underflow error!");
+    }
+    return left - right;
+  case '*':
+  {
+    bool overflow = false;
+    if (left > 0)
+    {
+      overflow = right > 0 ? left > max / right : right < min / left;
+    }
+    else if (left < 0)
+    {
+      overflow = right > 0 ? left < min / right : right != 0 && left < max / right;
+    }
+    if (overflow)
+    {
+      throw std::overflow_error("There was an overflow error!");
+    }
+    return left * right;
+  }
+  case '/':
+    if (left == min && right == -1)
+    {
+      throw std::overflow_error("There was an underflow error!");
+    }
+    if (right == 0)
+    {
+      throw std::runtime_error("Division by zero");
+    }
+    return left / right;
+  case '%':
+  {
+    if (right == 0)
+    {
+      throw std::runtime_error("Modulo by zero");
+    }
+    long long remainder = right == -1 ? 0 : left % right;
+    if (left < 0)
+    {
+      return right > 0 ? remainder + right : remainder - right;
+    }
+    return remainder;
+  }
+  default:
+    throw std::invalid_argument("Invalid operation");
+  }
+}
@@ -24,6 +24,8 @@ namespace zhitnyj {
   private:
     char operator_;
   };
+
+  long long applyOperator(char op, long long left, long long right);
 }
 
 #endif
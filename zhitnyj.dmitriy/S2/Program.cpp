@@ -0,0 +1,195 @@
+#include "Program.hpp"
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include "Operator.hpp"
+
+namespace {
+  bool isSpace(char c)
+  {
+    return std::isspace(static_cast< unsigned char >(c));
+  }
+
+  bool isDigit(char c)
+  {
+    return std::isdigit(static_cast< unsigned char >(c));
+  }
+
+  long long parseNumber(const char* begin, const char* end)
+  {
+    bool negative = *begin == '-';
+    if (negative)
+    {
+      ++begin;
+    }
+    const long long limit = negative ? std::numeric_limits< long long >::min() : -std::numeric_limits< long long >::max();
+    long long value = 0;
+    for (; begin != end && isDigit(*begin); ++begin)
+    {
+      int digit = *begin - '0';
+      if (value < (limit + digit) / 10)
+      {
+        throw std::out_of_range("stoll");
+      }
+      value = value * 10 - digit;
+    }
+    return negative ? value : -value;
+  }
+
+  int precedence(char op)
+  {
+    return zhitnyj::Operator(op).precedence();
+  }
+}
+
+zhitnyj::Program::Program():
+  code_(),
+  size_(0),
+  depth_(0),
+  fault_(nullptr)
+{}
+
+void zhitnyj::Program::push(long long value)
+{
+  if (fault_)
+  {
+    return;
+  }
+  code_.push_back({ OpCode::Push, value });
+  if (++size_ > depth_)
+  {
+    depth_ = size_;
+  }
+}
+
+void zhitnyj::Program::emit(char op)
+{
+  if (fault_)
+  {
+    return;
+  }
+  if (size_ < 2)
+  {
+    fault_ = "Insufficient values in the ep for operation";
+  }
+  else if (op == '(')
+  {
+    fault_ = "Invalid operation";
+  }
+  else
+  {
+    code_.push_back({ static_cast< OpCode >(op), 0 });
+    --size_;
+  }
+}
+
+zhitnyj::Program zhitnyj::Program::compile(const std::string& ep)
+{
+  Program program;
+  std::vector< char > operators;
+  bool unbalanced = false;
+  const char* current = ep.data();
+  const char* end = current + ep.size();
+
+  while (current != end)
+  {
+    if (isSpace(*current))
+    {
+      ++current;
+      continue;
+    }
+    const char* token = current;
+    while (current != end && !isSpace(*current))
+    {
+      ++current;
+    }
+    size_t length = current - token;
+
+    if (isDigit(token[0]) || (token[0] == '-' && length > 1 && isDigit(token[1])))
+    {
+      program.push(parseNumber(token, current));
+    }
+    else if (length != 1 || !Operator::isOperator(token[0]))
+    {
+      const char* where = current == end ? "Invalid token in expression: " : "Invalid token in ep: ";
+      throw std::runtime_error(where + std::string(token, current));
+    }
+    else if (unbalanced)
+    {
+      continue;
+    }
+    else if (token[0] == '(')
+    {
+      operators.push_back('(');
+    }
+    else if (token[0] == ')')
+    {
+      while (!operators.empty() && operators.back() != '(')
+      {
+        program.emit(operators.back());
+        operators.pop_back();
+      }
+      if (operators.empty())
+      {
+        unbalanced = true;
+        continue;
+      }
+      operators.pop_back();
+    }
+    else
+    {
+      while (!operators.empty() && operators.back() != '(' && precedence(operators.back()) >= precedence(token[0]))
+      {
+        program.emit(operators.back());
+        operators.pop_back();
+      }
+      operators.push_back(token[0]);
+    }
+  }
+
+  if (unbalanced)
+  {
+    throw std::out_of_range("Stack is empty");
+  }
+  while (!operators.empty())
+  {
+    program.emit(operators.back());
+    operators.pop_back();
+  }
+  if (!program.fault_ && program.size_ != 1)
+  {
+    program.fault_ = "The expression does not reduce to a single value";
+  }
+  return program;
+}
+
+long long zhitnyj::Program::run(std::vector< long long >& stack) const
+{
+  if (stack.size() < depth_)
+  {
+    stack.resize(depth_);
+  }
+  long long* top = stack.data();
+  for (const Instruction& instruction : code_)
+  {
+    switch (instruction.code)
+    {
+    case OpCode::Push:
+      *top++ = instruction.value;
+      break;
+    case OpCode::Add:
+    case OpCode::Subtract:
+    case OpCode::Multiply:
+    case OpCode::Divide:
+    case OpCode::Modulo:
+      --top;
+      top[-1] = applyOperator(static_cast< char >(instruction.code), top[-1], *top);
+      break;
+    }
+  }
+  if (fault_)
+  {
+    throw std::runtime_error(fault_);
+  }
+  return stack[0];
+}
@@ -0,0 +1,44 @@
+#ifndef PROGRAM_HPP
+#define PROGRAM_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace zhitnyj {
+  enum class OpCode : char
+  {
+    Push = 0,
+    Add = '+',
+    Subtract = '-',
+    Multiply = '*',
+    Divide = '/',
+    Modulo = '%'
+  };
+
+  struct Instruction
+  {
+    OpCode code;
+    long long value;
+  };
+
+  class Program
+  {
+  public:
+    Program();
+
+    static Program compile(const std::string& ep);
+    long long run(std::vector< long long >& stack) const;
+
+  private:
+    void push(long long value);
+    void emit(char op);
+
+    std::vector< Instruction > code_;
+    size_t size_;
+    size_t depth_;
+    const char* fault_;
+  };
+}
+
+#endif
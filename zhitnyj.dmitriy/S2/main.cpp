@@ -1,14 +1,12 @@
 #include <iostream>
 #include <fstream>
 #include <string>
-#include <Queue.hpp>
 #include <Stack.hpp>
-#include "ExpressionItem.hpp"
 #include "ExpressionEvaluator.hpp"
 
 int main(int argc, char* argv[])
 {
-  zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > expressionQueue;
+  zhitnyj::ExpressionEvaluator evaluator;
   zhitnyj::Stack< long long > results;
 
   try
@@ -26,10 +24,7 @@ int main(int argc, char* argv[])
       {
         if (!line.empty())
         {
-          zhitnyj::ExpressionEvaluator::parseExpression(expressionQueue, line);
-          zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > postfixQueue = zhitnyj::ExpressionEvaluator::toPostfix(expressionQueue);
-          results.push(zhitnyj::ExpressionEvaluator::evaluateExpression(postfixQueue));
-          expressionQueue.clear();
+          results.push(evaluator.evaluate(line));
         }
       }
     }
@@ -39,18 +34,19 @@ int main(int argc, char* argv[])
       {
         if (!line.empty())
         {
-          zhitnyj::ExpressionEvaluator::parseExpression(expressionQueue, line);
-          zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > postfixQueue = zhitnyj::ExpressionEvaluator::toPostfix(expressionQueue);
-          results.push(zhitnyj::ExpressionEvaluator::evaluateExpression(postfixQueue));
-          expressionQueue.clear();
+          results.push(evaluator.evaluate(line));
         }
       }
     }
 
     while (!results.empty())
     {
-      std::cout << results.top() << (results.size() == 1 ? "" : " ");
+      std::cout << results.top();
       results.pop();
+      if (!results.empty())
+      {
+        std::cout << " ";
+      }
     }
     std::cout << "\n";
   }